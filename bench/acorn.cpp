@@ -1,7 +1,14 @@
 #include "acorn.hpp"
+#include "acorn_bitsliced.hpp"
+#include "acorn_iovec.hpp"
+#include "acorn_parallel.hpp"
+#include "acorn_simd.hpp"
+#include "acorn_stream.hpp"
 #include "utils.hpp"
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <string.h>
+#include <vector>
 
 #define KNT_LEN 16u // secret key/ nonce/ tag length in bytes
 
@@ -106,6 +113,1108 @@ acorn_decrypt(benchmark::State& state,
   free(tag);
 }
 
+// Benchmark Acorn-128 authenticated encryption routine, specialized for
+// compile-time known byte lengths of plain text & associated data
+template<const size_t ct_len, const size_t data_len>
+static void
+acorn_encrypt_fixed(benchmark::State& state)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  random_data(text, ct_len);
+  random_data(data, data_len);
+  random_data(key, KNT_LEN);
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(tag, 0, KNT_LEN);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::encrypt<ct_len, data_len>(key, nonce, text, data, enc, tag);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark Acorn-128 verified decryption routine, specialized for
+// compile-time known byte lengths of cipher text & associated data
+template<const size_t ct_len, const size_t data_len>
+static void
+acorn_decrypt_fixed(benchmark::State& state)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  random_data(text, ct_len);
+  random_data(data, data_len);
+  random_data(key, KNT_LEN);
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tag, 0, KNT_LEN);
+
+  // compute encrypted text & authentication tag
+  acorn::encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace benchmark;
+    using namespace acorn;
+
+    DoNotOptimize(decrypt<ct_len, data_len>(key, nonce, tag, enc, data, dec));
+    DoNotOptimize(dec);
+    DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark Acorn-128 tag verification routine, which authenticates encrypted
+// text without writing decrypted text anywhere
+static void
+acorn_verify(benchmark::State& state,
+             const size_t ct_len,
+             const size_t data_len)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(tag, 0, KNT_LEN);
+
+  // compute encrypted text & authentication tag
+  acorn::encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace benchmark;
+    using namespace acorn;
+
+    bool flag = verify(key, nonce, tag, enc, ct_len, data, data_len);
+
+    DoNotOptimize(flag);
+    DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark in-place Acorn-128 authenticated encryption routine
+static void
+acorn_encrypt_inplace(benchmark::State& state,
+                      const size_t ct_len,
+                      const size_t data_len)
+{
+  // acquire memory resources
+  uint8_t* buf = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(buf, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(tag, 0, KNT_LEN);
+
+  // note, each iteration encrypts previous iteration's output
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::encrypt_inplace(key, nonce, buf, ct_len, data, data_len, tag);
+
+    benchmark::DoNotOptimize(buf);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(buf);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark in-place Acorn-128 verified decryption routine
+static void
+acorn_decrypt_inplace(benchmark::State& state,
+                      const size_t ct_len,
+                      const size_t data_len)
+{
+  // acquire memory resources
+  uint8_t* buf = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(buf, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(tag, 0, KNT_LEN);
+
+  // compute encrypted text & authentication tag
+  acorn::encrypt_inplace(key, nonce, buf, ct_len, data, data_len, tag);
+
+  // note, only first iteration decrypts successfully, rest of them fail
+  // verification, which doesn't change amount of work done
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace benchmark;
+    using namespace acorn;
+
+    bool flag = decrypt_inplace(key, nonce, tag, buf, ct_len, data, data_len);
+
+    DoNotOptimize(flag);
+    DoNotOptimize(buf);
+    DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(buf);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Splits `len` -bytes buffer into `seg_len` -bytes segments ( last one may be
+// shorter ), forming a scatter/ gather list
+template<typename seg_t, typename ptr_t>
+static std::vector<seg_t>
+segment(ptr_t buf, const size_t len, const size_t seg_len)
+{
+  std::vector<seg_t> segs;
+  for (size_t off = 0; off < len; off += seg_len) {
+    segs.push_back(seg_t{ buf + off, std::min(seg_len, len - off) });
+  }
+  return segs;
+}
+
+// Benchmark scatter/ gather Acorn-128 authenticated encryption routine, which
+// consumes associated data & plain text from lists of `seg_len` -bytes
+// segments, writing encrypted text to list of `seg_len` -bytes segments
+static void
+acorn_encryptv(benchmark::State& state,
+               const size_t ct_len,
+               const size_t data_len,
+               const size_t seg_len)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(tag, 0, KNT_LEN);
+
+  using namespace acorn;
+
+  const uint8_t* ctext = text;
+  const uint8_t* cdata = data;
+
+  const auto t_segs = segment<iovec_t>(ctext, ct_len, seg_len);
+  const auto d_segs = segment<iovec_t>(cdata, data_len, seg_len);
+  const auto e_segs = segment<iovec_mut_t>(enc, ct_len, seg_len);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    encryptv(key,
+             nonce,
+             t_segs.data(),
+             t_segs.size(),
+             d_segs.data(),
+             d_segs.size(),
+             e_segs.data(),
+             e_segs.size(),
+             tag);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark scatter/ gather Acorn-128 verified decryption routine, which
+// consumes associated data & cipher text from lists of `seg_len` -bytes
+// segments, writing decrypted text to list of `seg_len` -bytes segments
+static void
+acorn_decryptv(benchmark::State& state,
+               const size_t ct_len,
+               const size_t data_len,
+               const size_t seg_len)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tag, 0, KNT_LEN);
+
+  // compute encrypted text & authentication tag
+  acorn::encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+  using namespace acorn;
+
+  const uint8_t* cenc = enc;
+  const uint8_t* cdata = data;
+
+  const auto e_segs = segment<iovec_t>(cenc, ct_len, seg_len);
+  const auto d_segs = segment<iovec_t>(cdata, data_len, seg_len);
+  const auto t_segs = segment<iovec_mut_t>(dec, ct_len, seg_len);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    bool flag = decryptv(key,
+                         nonce,
+                         tag,
+                         e_segs.data(),
+                         e_segs.size(),
+                         d_segs.data(),
+                         d_segs.size(),
+                         t_segs.data(),
+                         t_segs.size());
+
+    benchmark::DoNotOptimize(flag);
+    benchmark::DoNotOptimize(dec);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark bitsliced Acorn-128 authenticated encryption routine, which
+// encrypts 64 independent messages at once
+static void
+acorn_bitsliced_encrypt(benchmark::State& state,
+                        const size_t ct_len,
+                        const size_t data_len)
+{
+  constexpr size_t lanes = acorn_bitsliced::LANE_CNT;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(lanes * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(lanes * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(lanes * data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, lanes * ct_len);
+  // random associated data bytes
+  random_data(data, lanes * data_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, lanes * KNT_LEN);
+  // random public message nonces ( = 128 -bit each )
+  random_data(nonce, lanes * KNT_LEN);
+
+  memset(enc, 0, lanes * ct_len);
+  memset(tag, 0, lanes * KNT_LEN);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace acorn_bitsliced;
+
+    encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  const size_t bytes = lanes * (data_len + ct_len) * itr;
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.SetItemsProcessed(static_cast<int64_t>(lanes * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark bitsliced Acorn-128 verified decryption routine, which decrypts
+// 64 independent messages at once
+static void
+acorn_bitsliced_decrypt(benchmark::State& state,
+                        const size_t ct_len,
+                        const size_t data_len)
+{
+  constexpr size_t lanes = acorn_bitsliced::LANE_CNT;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(lanes * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(lanes * ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(lanes * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(lanes * data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(lanes * KNT_LEN));
+  bool* flag = static_cast<bool*>(malloc(lanes * sizeof(bool)));
+
+  // random plain text bytes
+  random_data(text, lanes * ct_len);
+  // random associated data bytes
+  random_data(data, lanes * data_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, lanes * KNT_LEN);
+  // random public message nonces ( = 128 -bit each )
+  random_data(nonce, lanes * KNT_LEN);
+
+  memset(enc, 0, lanes * ct_len);
+  memset(dec, 0, lanes * ct_len);
+  memset(tag, 0, lanes * KNT_LEN);
+
+  // compute encrypted texts & authentication tags
+  acorn_bitsliced::encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace benchmark;
+    using namespace acorn_bitsliced;
+
+    decrypt(key, nonce, tag, enc, ct_len, data, data_len, dec, flag);
+
+    DoNotOptimize(dec);
+    DoNotOptimize(flag);
+    DoNotOptimize(itr++);
+  }
+
+  const size_t bytes = lanes * (data_len + ct_len) * itr;
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.SetItemsProcessed(static_cast<int64_t>(lanes * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(flag);
+}
+
+// Benchmark batched Acorn-128 authenticated encryption routine, which encrypts
+// `msg_cnt` independent messages, using SIMD registers ( if enabled )
+static void
+acorn_batch_encrypt(benchmark::State& state,
+                    const size_t ct_len,
+                    const size_t data_len,
+                    const size_t msg_cnt)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(msg_cnt * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(msg_cnt * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(msg_cnt * data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, msg_cnt * ct_len);
+  // random associated data bytes
+  random_data(data, msg_cnt * data_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, msg_cnt * KNT_LEN);
+  // random public message nonces ( = 128 -bit each )
+  random_data(nonce, msg_cnt * KNT_LEN);
+
+  memset(enc, 0, msg_cnt * ct_len);
+  memset(tag, 0, msg_cnt * KNT_LEN);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace acorn;
+
+    batch_encrypt(key, nonce, text, ct_len, data, data_len, enc, tag, msg_cnt);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  const size_t bytes = msg_cnt * (data_len + ct_len) * itr;
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark batched Acorn-128 verified decryption routine, which decrypts
+// `msg_cnt` independent messages, using SIMD registers ( if enabled )
+static void
+acorn_batch_decrypt(benchmark::State& state,
+                    const size_t ct_len,
+                    const size_t data_len,
+                    const size_t msg_cnt)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(msg_cnt * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(msg_cnt * ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(msg_cnt * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(msg_cnt * data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(msg_cnt * KNT_LEN));
+  bool* flag = static_cast<bool*>(malloc(msg_cnt * sizeof(bool)));
+
+  // random plain text bytes
+  random_data(text, msg_cnt * ct_len);
+  // random associated data bytes
+  random_data(data, msg_cnt * data_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, msg_cnt * KNT_LEN);
+  // random public message nonces ( = 128 -bit each )
+  random_data(nonce, msg_cnt * KNT_LEN);
+
+  memset(enc, 0, msg_cnt * ct_len);
+  memset(dec, 0, msg_cnt * ct_len);
+  memset(tag, 0, msg_cnt * KNT_LEN);
+
+  // compute encrypted texts & authentication tags
+  acorn::batch_encrypt(
+    key, nonce, text, ct_len, data, data_len, enc, tag, msg_cnt);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    using namespace benchmark;
+    using namespace acorn;
+
+    batch_decrypt(
+      key, nonce, tag, enc, ct_len, data, data_len, dec, flag, msg_cnt);
+
+    DoNotOptimize(dec);
+    DoNotOptimize(flag);
+    DoNotOptimize(itr++);
+  }
+
+  const size_t bytes = msg_cnt * (data_len + ct_len) * itr;
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(flag);
+}
+
+// Benchmark streaming Acorn-128 authenticated encryption routine, which
+// consumes associated data & plain text in chunks of `chunk_len` -bytes
+static void
+acorn_stream_encrypt(benchmark::State& state,
+                     const size_t ct_len,
+                     const size_t data_len,
+                     const size_t chunk_len)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len + 3));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len + 3);
+  memset(tag, 0, KNT_LEN);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::encryptor ctx{ key, nonce };
+
+    for (size_t off = 0; off < data_len; off += chunk_len) {
+      ctx.absorb_data(data + off, std::min(chunk_len, data_len - off));
+    }
+
+    size_t written = 0;
+    for (size_t off = 0; off < ct_len; off += chunk_len) {
+      const size_t len = std::min(chunk_len, ct_len - off);
+      written += ctx.encrypt_update(text + off, len, enc + written);
+    }
+
+    written += ctx.finalize(enc + written, tag);
+
+    benchmark::DoNotOptimize(written);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark streaming Acorn-128 verified decryption routine, which consumes
+// associated data & cipher text in chunks of `chunk_len` -bytes
+static void
+acorn_stream_decrypt(benchmark::State& state,
+                     const size_t ct_len,
+                     const size_t data_len,
+                     const size_t chunk_len)
+{
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len + 3));
+  uint8_t* data = static_cast<uint8_t*>(malloc(data_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(KNT_LEN));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(KNT_LEN));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, data_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, KNT_LEN);
+  // random public message nonce ( = 128 -bit )
+  random_data(nonce, KNT_LEN);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len + 3);
+  memset(tag, 0, KNT_LEN);
+
+  // compute encrypted text & authentication tag
+  acorn::encrypt(key, nonce, text, ct_len, data, data_len, enc, tag);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::decryptor ctx{ key, nonce };
+
+    for (size_t off = 0; off < data_len; off += chunk_len) {
+      ctx.absorb_data(data + off, std::min(chunk_len, data_len - off));
+    }
+
+    size_t written = 0;
+    for (size_t off = 0; off < ct_len; off += chunk_len) {
+      const size_t len = std::min(chunk_len, ct_len - off);
+      written += ctx.decrypt_update(enc + off, len, dec + written);
+    }
+
+    size_t tail = 0;
+    bool flag = ctx.finalize(tag, dec + written, tail);
+    written += tail;
+
+    benchmark::DoNotOptimize(written);
+    benchmark::DoNotOptimize(flag);
+    benchmark::DoNotOptimize(dec);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((data_len + ct_len) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark multi-threaded Acorn-128 authenticated encryption routine, on
+// `msg_cnt` -many independent messages, using `worker_cnt + 1` threads
+static void
+acorn_parallel_encrypt(benchmark::State& state,
+                       const size_t ct_len,
+                       const size_t data_len,
+                       const size_t msg_cnt,
+                       const size_t worker_cnt)
+{
+  acorn_parallel::thread_pool_t pool{ worker_cnt };
+
+  const size_t ct_size = msg_cnt * ct_len;
+  const size_t d_size = msg_cnt * data_len;
+  const size_t knt_size = msg_cnt * KNT_LEN;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+
+  random_data(text, ct_size);
+  random_data(data, d_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::parallel_encrypt(key,
+                            knt_size,
+                            nonce,
+                            knt_size,
+                            text,
+                            ct_size,
+                            data,
+                            d_size,
+                            enc,
+                            ct_size,
+                            tag,
+                            knt_size,
+                            msg_cnt,
+                            pool);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((d_size + ct_size) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark multi-threaded Acorn-128 verified decryption routine, on
+// `msg_cnt` -many independent messages, using `worker_cnt + 1` threads
+static void
+acorn_parallel_decrypt(benchmark::State& state,
+                       const size_t ct_len,
+                       const size_t data_len,
+                       const size_t msg_cnt,
+                       const size_t worker_cnt)
+{
+  acorn_parallel::thread_pool_t pool{ worker_cnt };
+
+  const size_t ct_size = msg_cnt * ct_len;
+  const size_t d_size = msg_cnt * data_len;
+  const size_t knt_size = msg_cnt * KNT_LEN;
+  const size_t flg_size = msg_cnt * sizeof(bool);
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(flg_size));
+
+  random_data(text, ct_size);
+  random_data(data, d_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+  memset(flag, 0, flg_size);
+
+  // compute encrypted texts & authentication tags
+  acorn::batch_encrypt(
+    key, nonce, text, ct_len, data, data_len, enc, tag, msg_cnt);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    const bool f = acorn::parallel_decrypt(key,
+                                           knt_size,
+                                           nonce,
+                                           knt_size,
+                                           tag,
+                                           knt_size,
+                                           enc,
+                                           ct_size,
+                                           data,
+                                           d_size,
+                                           dec,
+                                           ct_size,
+                                           flag,
+                                           flg_size,
+                                           msg_cnt,
+                                           pool);
+
+    benchmark::DoNotOptimize(f);
+    benchmark::DoNotOptimize(dec);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((d_size + ct_size) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(flag);
+}
+
+// Prepares text/ associated data offsets of a skewed ragged batch, where first
+// `bulk_cnt` messages carry 64 KiB plain text each, while rest are 40 -bytes
+// acknowledgements; all messages carry 16 -bytes associated data
+static void
+skewed_offsets(std::vector<size_t>& ct_off,
+               std::vector<size_t>& d_off,
+               const size_t msg_cnt,
+               const size_t bulk_cnt)
+{
+  ct_off.assign(msg_cnt + 1, 0);
+  d_off.assign(msg_cnt + 1, 0);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    ct_off[i + 1] = ct_off[i] + ((i < bulk_cnt) ? 65536ul : 40ul);
+    d_off[i + 1] = d_off[i] + 16ul;
+  }
+}
+
+// Benchmark multi-threaded Acorn-128 authenticated encryption routine, on a
+// skewed ragged batch of `msg_cnt` -many messages, using all CPU cores &
+// chosen scheduling policy
+static void
+acorn_ragged_encrypt(benchmark::State& state,
+                     const size_t msg_cnt,
+                     const size_t bulk_cnt,
+                     const acorn_parallel::schedule_t sched)
+{
+  std::vector<size_t> ct_off;
+  std::vector<size_t> d_off;
+  skewed_offsets(ct_off, d_off, msg_cnt, bulk_cnt);
+
+  const size_t ct_size = ct_off[msg_cnt];
+  const size_t d_size = d_off[msg_cnt];
+  const size_t knt_size = msg_cnt * KNT_LEN;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+
+  random_data(text, ct_size);
+  random_data(data, d_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  auto& pool = acorn_parallel::default_pool();
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    acorn::parallel_encrypt_ragged(key,
+                                   nonce,
+                                   text,
+                                   ct_off.data(),
+                                   data,
+                                   d_off.data(),
+                                   enc,
+                                   tag,
+                                   msg_cnt,
+                                   pool,
+                                   sched);
+
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((d_size + ct_size) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark multi-threaded Acorn-128 verified decryption routine, on a skewed
+// ragged batch of `msg_cnt` -many messages, using all CPU cores & chosen
+// scheduling policy
+static void
+acorn_ragged_decrypt(benchmark::State& state,
+                     const size_t msg_cnt,
+                     const size_t bulk_cnt,
+                     const acorn_parallel::schedule_t sched)
+{
+  std::vector<size_t> ct_off;
+  std::vector<size_t> d_off;
+  skewed_offsets(ct_off, d_off, msg_cnt, bulk_cnt);
+
+  const size_t ct_size = ct_off[msg_cnt];
+  const size_t d_size = d_off[msg_cnt];
+  const size_t knt_size = msg_cnt * KNT_LEN;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(msg_cnt * sizeof(bool)));
+
+  random_data(text, ct_size);
+  random_data(data, d_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+  memset(flag, 0, msg_cnt * sizeof(bool));
+
+  auto& pool = acorn_parallel::default_pool();
+
+  // compute encrypted texts & authentication tags
+  acorn::parallel_encrypt_ragged(key,
+                                 nonce,
+                                 text,
+                                 ct_off.data(),
+                                 data,
+                                 d_off.data(),
+                                 enc,
+                                 tag,
+                                 msg_cnt,
+                                 pool);
+
+  size_t itr = 0;
+  for (auto _ : state) {
+    const bool f = acorn::parallel_decrypt_ragged(key,
+                                                  nonce,
+                                                  tag,
+                                                  enc,
+                                                  ct_off.data(),
+                                                  data,
+                                                  d_off.data(),
+                                                  dec,
+                                                  flag,
+                                                  msg_cnt,
+                                                  pool,
+                                                  sched);
+
+    benchmark::DoNotOptimize(f);
+    benchmark::DoNotOptimize(dec);
+    benchmark::DoNotOptimize(itr++);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>((d_size + ct_size) * itr));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * itr));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(dec);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(flag);
+}
+
+// Benchmark Acorn-128 encrypt routine with empty plain text & associated data,
+// measuring fixed per-message cost ( initialization, padding & finalization )
+static void
+acorn_encrypt_0B_0B(benchmark::State& state)
+{
+  acorn_encrypt(state, 0ul, 0ul);
+}
+
+// Benchmark Acorn-128 encrypt routine with 16 -bytes plain text & 16 -bytes
+// associated data, where fixed per-message cost dominates
+static void
+acorn_encrypt_16B_16B(benchmark::State& state)
+{
+  acorn_encrypt(state, 16ul, 16ul);
+}
+
+// Benchmark Acorn-128 decrypt routine with empty cipher text & associated data,
+// measuring fixed per-message cost ( initialization, padding & finalization )
+static void
+acorn_decrypt_0B_0B(benchmark::State& state)
+{
+  acorn_decrypt(state, 0ul, 0ul);
+}
+
+// Benchmark Acorn-128 decrypt routine with 16 -bytes cipher text & 16 -bytes
+// associated data, where fixed per-message cost dominates
+static void
+acorn_decrypt_16B_16B(benchmark::State& state)
+{
+  acorn_decrypt(state, 16ul, 16ul);
+}
+
 // Benchmark Acorn-128 encrypt routine with 64 -bytes plain text & 32 -bytes
 // associated data
 static void
@@ -218,9 +1327,366 @@ acorn_decrypt_4096B_32B(benchmark::State& state)
   acorn_decrypt(state, 4096ul, 32ul);
 }
 
+// Benchmark Acorn-128 verify routine with 64 -bytes cipher text & 32 -bytes
+// associated data
+static void
+acorn_verify_64B_32B(benchmark::State& state)
+{
+  acorn_verify(state, 64ul, 32ul);
+}
+
+// Benchmark Acorn-128 verify routine with 256 -bytes cipher text & 32 -bytes
+// associated data
+static void
+acorn_verify_256B_32B(benchmark::State& state)
+{
+  acorn_verify(state, 256ul, 32ul);
+}
+
+// Benchmark Acorn-128 verify routine with 1024 -bytes cipher text & 32 -bytes
+// associated data
+static void
+acorn_verify_1024B_32B(benchmark::State& state)
+{
+  acorn_verify(state, 1024ul, 32ul);
+}
+
+// Benchmark Acorn-128 verify routine with 4096 -bytes cipher text & 32 -bytes
+// associated data
+static void
+acorn_verify_4096B_32B(benchmark::State& state)
+{
+  acorn_verify(state, 4096ul, 32ul);
+}
+
+// Benchmark in-place Acorn-128 encrypt routine with 1024 -bytes plain text &
+// 32 -bytes associated data
+static void
+acorn_encrypt_inplace_1024B_32B(benchmark::State& state)
+{
+  acorn_encrypt_inplace(state, 1024ul, 32ul);
+}
+
+// Benchmark in-place Acorn-128 encrypt routine with 4096 -bytes plain text &
+// 32 -bytes associated data
+static void
+acorn_encrypt_inplace_4096B_32B(benchmark::State& state)
+{
+  acorn_encrypt_inplace(state, 4096ul, 32ul);
+}
+
+// Benchmark in-place Acorn-128 decrypt routine with 1024 -bytes cipher text &
+// 32 -bytes associated data
+static void
+acorn_decrypt_inplace_1024B_32B(benchmark::State& state)
+{
+  acorn_decrypt_inplace(state, 1024ul, 32ul);
+}
+
+// Benchmark in-place Acorn-128 decrypt routine with 4096 -bytes cipher text &
+// 32 -bytes associated data
+static void
+acorn_decrypt_inplace_4096B_32B(benchmark::State& state)
+{
+  acorn_decrypt_inplace(state, 4096ul, 32ul);
+}
+
+// Benchmark scatter/ gather Acorn-128 encrypt routine with 1024 -bytes plain
+// text & 32 -bytes associated data, split into 61 -bytes segments
+static void
+acorn_encryptv_1024B_32B(benchmark::State& state)
+{
+  acorn_encryptv(state, 1024ul, 32ul, 61ul);
+}
+
+// Benchmark scatter/ gather Acorn-128 encrypt routine with 4096 -bytes plain
+// text & 32 -bytes associated data, split into 61 -bytes segments
+static void
+acorn_encryptv_4096B_32B(benchmark::State& state)
+{
+  acorn_encryptv(state, 4096ul, 32ul, 61ul);
+}
+
+// Benchmark scatter/ gather Acorn-128 decrypt routine with 1024 -bytes cipher
+// text & 32 -bytes associated data, split into 61 -bytes segments
+static void
+acorn_decryptv_1024B_32B(benchmark::State& state)
+{
+  acorn_decryptv(state, 1024ul, 32ul, 61ul);
+}
+
+// Benchmark scatter/ gather Acorn-128 decrypt routine with 4096 -bytes cipher
+// text & 32 -bytes associated data, split into 61 -bytes segments
+static void
+acorn_decryptv_4096B_32B(benchmark::State& state)
+{
+  acorn_decryptv(state, 4096ul, 32ul, 61ul);
+}
+
+// Benchmark bitsliced Acorn-128 encrypt routine with 64 messages, each of
+// 64 -bytes plain text & 32 -bytes associated data
+static void
+acorn_bitsliced_encrypt_64B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_encrypt(state, 64ul, 32ul);
+}
+
+// Benchmark bitsliced Acorn-128 encrypt routine with 64 messages, each of
+// 128 -bytes plain text & 32 -bytes associated data
+static void
+acorn_bitsliced_encrypt_128B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_encrypt(state, 128ul, 32ul);
+}
+
+// Benchmark bitsliced Acorn-128 encrypt routine with 64 messages, each of
+// 256 -bytes plain text & 32 -bytes associated data
+static void
+acorn_bitsliced_encrypt_256B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_encrypt(state, 256ul, 32ul);
+}
+
+// Benchmark bitsliced Acorn-128 decrypt routine with 64 messages, each of
+// 64 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_bitsliced_decrypt_64B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_decrypt(state, 64ul, 32ul);
+}
+
+// Benchmark bitsliced Acorn-128 decrypt routine with 64 messages, each of
+// 128 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_bitsliced_decrypt_128B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_decrypt(state, 128ul, 32ul);
+}
+
+// Benchmark bitsliced Acorn-128 decrypt routine with 64 messages, each of
+// 256 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_bitsliced_decrypt_256B_32B(benchmark::State& state)
+{
+  acorn_bitsliced_decrypt(state, 256ul, 32ul);
+}
+
+// Benchmark batched Acorn-128 encrypt routine with 64 messages, each of
+// 64 -bytes plain text & 32 -bytes associated data
+static void
+acorn_batch_encrypt_64B_32B(benchmark::State& state)
+{
+  acorn_batch_encrypt(state, 64ul, 32ul, 64ul);
+}
+
+// Benchmark batched Acorn-128 encrypt routine with 64 messages, each of
+// 128 -bytes plain text & 32 -bytes associated data
+static void
+acorn_batch_encrypt_128B_32B(benchmark::State& state)
+{
+  acorn_batch_encrypt(state, 128ul, 32ul, 64ul);
+}
+
+// Benchmark batched Acorn-128 encrypt routine with 64 messages, each of
+// 256 -bytes plain text & 32 -bytes associated data
+static void
+acorn_batch_encrypt_256B_32B(benchmark::State& state)
+{
+  acorn_batch_encrypt(state, 256ul, 32ul, 64ul);
+}
+
+// Benchmark batched Acorn-128 decrypt routine with 64 messages, each of
+// 64 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_batch_decrypt_64B_32B(benchmark::State& state)
+{
+  acorn_batch_decrypt(state, 64ul, 32ul, 64ul);
+}
+
+// Benchmark batched Acorn-128 decrypt routine with 64 messages, each of
+// 128 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_batch_decrypt_128B_32B(benchmark::State& state)
+{
+  acorn_batch_decrypt(state, 128ul, 32ul, 64ul);
+}
+
+// Benchmark batched Acorn-128 decrypt routine with 64 messages, each of
+// 256 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_batch_decrypt_256B_32B(benchmark::State& state)
+{
+  acorn_batch_decrypt(state, 256ul, 32ul, 64ul);
+}
+
+// Benchmark streaming Acorn-128 encrypt routine with 1024 -bytes plain text &
+// 32 -bytes associated data, fed in 61 -bytes chunks
+static void
+acorn_stream_encrypt_1024B_32B(benchmark::State& state)
+{
+  acorn_stream_encrypt(state, 1024ul, 32ul, 61ul);
+}
+
+// Benchmark streaming Acorn-128 encrypt routine with 4096 -bytes plain text &
+// 32 -bytes associated data, fed in 61 -bytes chunks
+static void
+acorn_stream_encrypt_4096B_32B(benchmark::State& state)
+{
+  acorn_stream_encrypt(state, 4096ul, 32ul, 61ul);
+}
+
+// Benchmark streaming Acorn-128 decrypt routine with 1024 -bytes cipher text &
+// 32 -bytes associated data, fed in 61 -bytes chunks
+static void
+acorn_stream_decrypt_1024B_32B(benchmark::State& state)
+{
+  acorn_stream_decrypt(state, 1024ul, 32ul, 61ul);
+}
+
+// Benchmark streaming Acorn-128 decrypt routine with 4096 -bytes cipher text &
+// 32 -bytes associated data, fed in 61 -bytes chunks
+static void
+acorn_stream_decrypt_4096B_32B(benchmark::State& state)
+{
+  acorn_stream_decrypt(state, 4096ul, 32ul, 61ul);
+}
+
+// Benchmark Acorn-128 encrypt routine, specialized for compile-time known
+// 16 -bytes plain text & 16 -bytes associated data
+static void
+acorn_encrypt_fixed_16B_16B(benchmark::State& state)
+{
+  acorn_encrypt_fixed<16ul, 16ul>(state);
+}
+
+// Benchmark Acorn-128 encrypt routine, specialized for compile-time known
+// 64 -bytes plain text & 32 -bytes associated data
+static void
+acorn_encrypt_fixed_64B_32B(benchmark::State& state)
+{
+  acorn_encrypt_fixed<64ul, 32ul>(state);
+}
+
+// Benchmark Acorn-128 encrypt routine, specialized for compile-time known
+// 1024 -bytes plain text & 32 -bytes associated data
+static void
+acorn_encrypt_fixed_1024B_32B(benchmark::State& state)
+{
+  acorn_encrypt_fixed<1024ul, 32ul>(state);
+}
+
+// Benchmark Acorn-128 decrypt routine, specialized for compile-time known
+// 16 -bytes cipher text & 16 -bytes associated data
+static void
+acorn_decrypt_fixed_16B_16B(benchmark::State& state)
+{
+  acorn_decrypt_fixed<16ul, 16ul>(state);
+}
+
+// Benchmark Acorn-128 decrypt routine, specialized for compile-time known
+// 64 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_decrypt_fixed_64B_32B(benchmark::State& state)
+{
+  acorn_decrypt_fixed<64ul, 32ul>(state);
+}
+
+// Benchmark Acorn-128 decrypt routine, specialized for compile-time known
+// 1024 -bytes cipher text & 32 -bytes associated data
+static void
+acorn_decrypt_fixed_1024B_32B(benchmark::State& state)
+{
+  acorn_decrypt_fixed<1024ul, 32ul>(state);
+}
+
+// # -of worker threads, such that along with calling thread, all available CPU
+// cores are occupied
+static size_t
+all_cores()
+{
+  return std::max(std::thread::hardware_concurrency(), 1u) - 1u;
+}
+
+// Benchmark multi-threaded Acorn-128 encrypt routine with 1024 messages, each
+// of 256 -bytes plain text & 32 -bytes associated data, on single thread
+static void
+acorn_parallel_encrypt_256B_32B_1T(benchmark::State& state)
+{
+  acorn_parallel_encrypt(state, 256ul, 32ul, 1024ul, 0ul);
+}
+
+// Benchmark multi-threaded Acorn-128 encrypt routine with 1024 messages, each
+// of 256 -bytes plain text & 32 -bytes associated data, on all CPU cores
+static void
+acorn_parallel_encrypt_256B_32B_NT(benchmark::State& state)
+{
+  acorn_parallel_encrypt(state, 256ul, 32ul, 1024ul, all_cores());
+}
+
+// Benchmark multi-threaded Acorn-128 decrypt routine with 1024 messages, each
+// of 256 -bytes cipher text & 32 -bytes associated data, on single thread
+static void
+acorn_parallel_decrypt_256B_32B_1T(benchmark::State& state)
+{
+  acorn_parallel_decrypt(state, 256ul, 32ul, 1024ul, 0ul);
+}
+
+// Benchmark multi-threaded Acorn-128 decrypt routine with 1024 messages, each
+// of 256 -bytes cipher text & 32 -bytes associated data, on all CPU cores
+static void
+acorn_parallel_decrypt_256B_32B_NT(benchmark::State& state)
+{
+  acorn_parallel_decrypt(state, 256ul, 32ul, 1024ul, all_cores());
+}
+
+// Benchmark multi-threaded Acorn-128 encrypt routine on a skewed ragged batch
+// of 1024 messages, first 16 of which are 64 KiB long, using static
+// partitioning
+static void
+acorn_ragged_encrypt_skewed_static(benchmark::State& state)
+{
+  using namespace acorn_parallel;
+
+  acorn_ragged_encrypt(state, 1024ul, 16ul, schedule_t::static_chunk);
+}
+
+// Benchmark multi-threaded Acorn-128 encrypt routine on a skewed ragged batch
+// of 1024 messages, first 16 of which are 64 KiB long, using work stealing
+static void
+acorn_ragged_encrypt_skewed_stealing(benchmark::State& state)
+{
+  using namespace acorn_parallel;
+
+  acorn_ragged_encrypt(state, 1024ul, 16ul, schedule_t::work_stealing);
+}
+
+// Benchmark multi-threaded Acorn-128 decrypt routine on a skewed ragged batch
+// of 1024 messages, first 16 of which are 64 KiB long, using static
+// partitioning
+static void
+acorn_ragged_decrypt_skewed_static(benchmark::State& state)
+{
+  using namespace acorn_parallel;
+
+  acorn_ragged_decrypt(state, 1024ul, 16ul, schedule_t::static_chunk);
+}
+
+// Benchmark multi-threaded Acorn-128 decrypt routine on a skewed ragged batch
+// of 1024 messages, first 16 of which are 64 KiB long, using work stealing
+static void
+acorn_ragged_decrypt_skewed_stealing(benchmark::State& state)
+{
+  using namespace acorn_parallel;
+
+  acorn_ragged_decrypt(state, 1024ul, 16ul, schedule_t::work_stealing);
+}
+
 // register for benchmarking
 //
-// Note, associated data size is kept constant for all benchmaark cases !
+// Note, associated data size is kept constant for all benchmaark cases, except
+// ones measuring fixed per-message cost !
+BENCHMARK(acorn_encrypt_0B_0B);
+BENCHMARK(acorn_encrypt_16B_16B);
 BENCHMARK(acorn_encrypt_64B_32B);
 BENCHMARK(acorn_encrypt_128B_32B);
 BENCHMARK(acorn_encrypt_256B_32B);
@@ -229,6 +1695,8 @@ BENCHMARK(acorn_encrypt_1024B_32B);
 BENCHMARK(acorn_encrypt_2048B_32B);
 BENCHMARK(acorn_encrypt_4096B_32B);
 
+BENCHMARK(acorn_decrypt_0B_0B);
+BENCHMARK(acorn_decrypt_16B_16B);
 BENCHMARK(acorn_decrypt_64B_32B);
 BENCHMARK(acorn_decrypt_128B_32B);
 BENCHMARK(acorn_decrypt_256B_32B);
@@ -237,5 +1705,66 @@ BENCHMARK(acorn_decrypt_1024B_32B);
 BENCHMARK(acorn_decrypt_2048B_32B);
 BENCHMARK(acorn_decrypt_4096B_32B);
 
+BENCHMARK(acorn_verify_64B_32B);
+BENCHMARK(acorn_verify_256B_32B);
+BENCHMARK(acorn_verify_1024B_32B);
+BENCHMARK(acorn_verify_4096B_32B);
+
+BENCHMARK(acorn_encrypt_inplace_1024B_32B);
+BENCHMARK(acorn_encrypt_inplace_4096B_32B);
+
+BENCHMARK(acorn_decrypt_inplace_1024B_32B);
+BENCHMARK(acorn_decrypt_inplace_4096B_32B);
+
+BENCHMARK(acorn_encryptv_1024B_32B);
+BENCHMARK(acorn_encryptv_4096B_32B);
+
+BENCHMARK(acorn_decryptv_1024B_32B);
+BENCHMARK(acorn_decryptv_4096B_32B);
+
+BENCHMARK(acorn_bitsliced_encrypt_64B_32B);
+BENCHMARK(acorn_bitsliced_encrypt_128B_32B);
+BENCHMARK(acorn_bitsliced_encrypt_256B_32B);
+
+BENCHMARK(acorn_bitsliced_decrypt_64B_32B);
+BENCHMARK(acorn_bitsliced_decrypt_128B_32B);
+BENCHMARK(acorn_bitsliced_decrypt_256B_32B);
+
+BENCHMARK(acorn_batch_encrypt_64B_32B);
+BENCHMARK(acorn_batch_encrypt_128B_32B);
+BENCHMARK(acorn_batch_encrypt_256B_32B);
+
+BENCHMARK(acorn_batch_decrypt_64B_32B);
+BENCHMARK(acorn_batch_decrypt_128B_32B);
+BENCHMARK(acorn_batch_decrypt_256B_32B);
+
+BENCHMARK(acorn_stream_encrypt_1024B_32B);
+BENCHMARK(acorn_stream_encrypt_4096B_32B);
+
+BENCHMARK(acorn_stream_decrypt_1024B_32B);
+BENCHMARK(acorn_stream_decrypt_4096B_32B);
+
+BENCHMARK(acorn_encrypt_fixed_16B_16B);
+BENCHMARK(acorn_encrypt_fixed_64B_32B);
+BENCHMARK(acorn_encrypt_fixed_1024B_32B);
+
+BENCHMARK(acorn_decrypt_fixed_16B_16B);
+BENCHMARK(acorn_decrypt_fixed_64B_32B);
+BENCHMARK(acorn_decrypt_fixed_1024B_32B);
+
+// multi-threaded cases are timed using wall clock, as CPU time of calling
+// thread alone doesn't account for work done by other threads
+BENCHMARK(acorn_parallel_encrypt_256B_32B_1T)->UseRealTime();
+BENCHMARK(acorn_parallel_encrypt_256B_32B_NT)->UseRealTime();
+
+BENCHMARK(acorn_parallel_decrypt_256B_32B_1T)->UseRealTime();
+BENCHMARK(acorn_parallel_decrypt_256B_32B_NT)->UseRealTime();
+
+BENCHMARK(acorn_ragged_encrypt_skewed_static)->UseRealTime();
+BENCHMARK(acorn_ragged_encrypt_skewed_stealing)->UseRealTime();
+
+BENCHMARK(acorn_ragged_decrypt_skewed_static)->UseRealTime();
+BENCHMARK(acorn_ragged_decrypt_skewed_stealing)->UseRealTime();
+
 // main function to make it executable
 BENCHMARK_MAIN();
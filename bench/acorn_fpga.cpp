@@ -6,6 +6,44 @@
 #define FPGA_EMU
 #endif
 
+// Inputs are generated on device, so that kernel throughput isn't bounded by
+// host; define `HOST_INPUTS` for end-to-end numbers, with inputs generated on
+// host & shipped to device
+#if defined HOST_INPUTS
+constexpr auto input_from = bench_acorn_fpga::input_src::host_gen;
+constexpr const char* input_col = "host-to-device b/w";
+#else
+constexpr auto input_from = bench_acorn_fpga::input_src::device_gen;
+constexpr const char* input_col = "input generation b/w";
+#endif
+
+// Adds a row, comparing kernel bandwidth of single kernel, piped kernels &
+// burst kernel, all specialized on `ct_len` -bytes text & `d_len` -bytes
+// associated data, to table
+template<const size_t ct_len, const size_t d_len>
+static void
+fixed_row(sycl::queue& q, const size_t invk_cnt, TextTable& t)
+{
+  using namespace bench_acorn_fpga;
+
+  size_t io[1];
+
+  const uint64_t t_single =
+    exec_fixed<ct_len, d_len>(q, invk_cnt, fixed_single, io);
+  const uint64_t t_piped =
+    exec_fixed<ct_len, d_len>(q, invk_cnt, fixed_piped, io);
+  const uint64_t t_burst =
+    exec_fixed<ct_len, d_len>(q, invk_cnt, fixed_burst, io);
+
+  t.add(std::to_string(invk_cnt));
+  t.add(std::to_string(ct_len));
+  t.add(std::to_string(d_len));
+  t.add(to_readable_bandwidth(io[0], t_single));
+  t.add(to_readable_bandwidth(io[0], t_piped));
+  t.add(to_readable_bandwidth(io[0], t_burst));
+  t.endOfRow();
+}
+
 int
 main()
 {
@@ -42,7 +80,7 @@ main()
   t0.add("invocation count");
   t0.add("plain text len ( bytes )");
   t0.add("associated data len ( bytes )");
-  t0.add("host-to-device b/w");
+  t0.add(input_col);
   t0.add("kernel b/w");
   t0.add("device-to-host b/w");
   t0.endOfRow();
@@ -55,7 +93,10 @@ main()
                                     invk,
                                     bench_acorn_fpga::acorn_type::acorn_encrypt,
                                     ts,
-                                    io);
+                                    io,
+                                    bench_acorn_fpga::kernel_type::single_task,
+                                    bench_acorn_fpga::host_mem_type::pageable,
+                                    input_from);
 
       t0.add(std::to_string(invk));
       t0.add(std::to_string(ct_len));
@@ -83,7 +124,7 @@ main()
   t1.add("invocation count");
   t1.add("cipher text len ( bytes )");
   t1.add("associated data len ( bytes )");
-  t1.add("host-to-device b/w");
+  t1.add(input_col);
   t1.add("kernel b/w");
   t1.add("device-to-host b/w");
   t1.endOfRow();
@@ -96,7 +137,10 @@ main()
                                     invk,
                                     bench_acorn_fpga::acorn_type::acorn_decrypt,
                                     ts,
-                                    io);
+                                    io,
+                                    bench_acorn_fpga::kernel_type::single_task,
+                                    bench_acorn_fpga::host_mem_type::pageable,
+                                    input_from);
 
       t1.add(std::to_string(invk));
       t1.add(std::to_string(ct_len));
@@ -115,6 +159,285 @@ main()
   t1.setAlignment(5, TextTable::Alignment::RIGHT);
   std::cout << t1;
 
+  // streaming pipeline, fixed batch of messages, chunked & overlapped across
+  // 1, 2 & 3 in-flight device buffers; end-to-end throughput is reported
+  constexpr size_t stream_invk_cnt = max_invk_cnt;
+  constexpr size_t stream_chunk_cnt = stream_invk_cnt >> 3;
+  constexpr size_t max_depth = 3ul;
+
+  for (size_t k = 0; k < 2; k++) {
+    using namespace bench_acorn_fpga;
+    const acorn_type type = k == 0 ? acorn_encrypt : acorn_decrypt;
+
+    std::cout << std::endl
+              << "Benchmarking streamed Acorn-128 "
+              << (type == acorn_encrypt ? "encrypt" : "decrypt") << std::endl
+              << std::endl;
+
+    TextTable t2('-', '|', '+');
+
+    t2.add("invocation count");
+    t2.add("chunk size");
+    t2.add("text len ( bytes )");
+    t2.add("associated data len ( bytes )");
+    t2.add("in-flight buffers");
+    t2.add("end-to-end b/w");
+    t2.endOfRow();
+
+    for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 2) {
+      for (size_t depth = 1; depth <= max_depth; depth++) {
+        const uint64_t t = exec_stream(q,
+                                       ct_len,
+                                       dt_len,
+                                       stream_invk_cnt,
+                                       stream_chunk_cnt,
+                                       depth,
+                                       type,
+                                       io);
+
+        t2.add(std::to_string(stream_invk_cnt));
+        t2.add(std::to_string(stream_chunk_cnt));
+        t2.add(std::to_string(ct_len));
+        t2.add(std::to_string(dt_len));
+        t2.add(std::to_string(depth));
+        t2.add(to_readable_bandwidth(io[0], t));
+        t2.endOfRow();
+      }
+    }
+
+    t2.setAlignment(1, TextTable::Alignment::RIGHT);
+    t2.setAlignment(2, TextTable::Alignment::RIGHT);
+    t2.setAlignment(3, TextTable::Alignment::RIGHT);
+    t2.setAlignment(4, TextTable::Alignment::RIGHT);
+    t2.setAlignment(5, TextTable::Alignment::RIGHT);
+    std::cout << t2;
+  }
+
+  // small-batch latency, with & without reusing device buffers from a pool
+  constexpr size_t rounds = 1ul << 8;
+
+  std::cout << std::endl
+            << "Benchmarking small-batch Acorn-128 encrypt latency"
+            << std::endl
+            << std::endl;
+
+  TextTable t3('-', '|', '+');
+
+  t3.add("invocation count");
+  t3.add("plain text len ( bytes )");
+  t3.add("associated data len ( bytes )");
+  t3.add("unpooled latency ( us )");
+  t3.add("pooled latency ( us )");
+  t3.add("pool hits");
+  t3.add("pool misses");
+  t3.endOfRow();
+
+  for (size_t invk = 1; invk <= 256; invk <<= 2) {
+    using namespace bench_acorn_fpga;
+
+    acorn_usm::pool_t pool{ q, sycl::usm::alloc::device };
+
+    const uint64_t t_raw =
+      exec_small_batches(q, min_ct_len, dt_len, invk, rounds, nullptr);
+    const uint64_t t_pool =
+      exec_small_batches(q, min_ct_len, dt_len, invk, rounds, &pool);
+    const acorn_usm::stats_t st = pool.stats();
+
+    t3.add(std::to_string(invk));
+    t3.add(std::to_string(min_ct_len));
+    t3.add(std::to_string(dt_len));
+    t3.add(std::to_string(static_cast<double>(t_raw) * 1e-3));
+    t3.add(std::to_string(static_cast<double>(t_pool) * 1e-3));
+    t3.add(std::to_string(st.hits));
+    t3.add(std::to_string(st.misses));
+    t3.endOfRow();
+  }
+
+  t3.setAlignment(1, TextTable::Alignment::RIGHT);
+  t3.setAlignment(2, TextTable::Alignment::RIGHT);
+  t3.setAlignment(3, TextTable::Alignment::RIGHT);
+  t3.setAlignment(4, TextTable::Alignment::RIGHT);
+  t3.setAlignment(5, TextTable::Alignment::RIGHT);
+  t3.setAlignment(6, TextTable::Alignment::RIGHT);
+  std::cout << t3;
+
+  // host <-> device bandwidth, by where host side buffers live
+  std::cout << std::endl
+            << "Benchmarking Acorn-128 encrypt, by host memory allocation"
+            << std::endl
+            << std::endl;
+
+  TextTable t4('-', '|', '+');
+
+  t4.add("invocation count");
+  t4.add("plain text len ( bytes )");
+  t4.add("host memory");
+  t4.add("host-to-device b/w");
+  t4.add("kernel b/w");
+  t4.add("device-to-host b/w");
+  t4.endOfRow();
+
+  for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 2) {
+    for (size_t m = 0; m < 3; m++) {
+      using namespace bench_acorn_fpga;
+
+      const host_mem_type mem = static_cast<host_mem_type>(m);
+      const char* mem_name[]{ "pageable", "pinned", "shared" };
+
+      exec_kernel(q,
+                  ct_len,
+                  dt_len,
+                  min_invk_cnt,
+                  acorn_type::acorn_encrypt,
+                  ts,
+                  io,
+                  kernel_type::single_task,
+                  mem);
+
+      t4.add(std::to_string(min_invk_cnt));
+      t4.add(std::to_string(ct_len));
+      t4.add(mem_name[m]);
+      t4.add(to_readable_bandwidth(io[0], ts[0]));
+      t4.add(to_readable_bandwidth(io[1], ts[1]));
+      t4.add(to_readable_bandwidth(io[2], ts[2]));
+      t4.endOfRow();
+    }
+  }
+
+  t4.setAlignment(1, TextTable::Alignment::RIGHT);
+  t4.setAlignment(3, TextTable::Alignment::RIGHT);
+  t4.setAlignment(4, TextTable::Alignment::RIGHT);
+  t4.setAlignment(5, TextTable::Alignment::RIGHT);
+  std::cout << t4;
+
+  // kernel bandwidth, single pipeline vs. replicated compute units
+  std::cout << std::endl
+            << "Benchmarking Acorn-128 encrypt, on "
+            << bench_acorn_fpga::CU_CNT << " replicated compute units"
+            << std::endl
+            << std::endl;
+
+  TextTable t5('-', '|', '+');
+
+  t5.add("invocation count");
+  t5.add("plain text len ( bytes )");
+  t5.add("associated data len ( bytes )");
+  t5.add("single kernel b/w");
+  t5.add("replicated kernel b/w");
+  t5.endOfRow();
+
+  for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 2) {
+    using namespace bench_acorn_fpga;
+
+    // both runs request same buffer sizes, so second one reuses device memory
+    acorn_usm::pool_t pool{ q, sycl::usm::alloc::device };
+
+    exec_kernel(q,
+                ct_len,
+                dt_len,
+                max_invk_cnt,
+                acorn_encrypt,
+                ts,
+                io,
+                kernel_type::single_task,
+                pageable,
+                input_from,
+                &pool);
+    const uint64_t t_single = ts[1];
+
+    exec_kernel(q,
+                ct_len,
+                dt_len,
+                max_invk_cnt,
+                acorn_encrypt,
+                ts,
+                io,
+                kernel_type::replicated,
+                pageable,
+                input_from,
+                &pool);
+    const uint64_t t_replicated = ts[1];
+
+    t5.add(std::to_string(max_invk_cnt));
+    t5.add(std::to_string(ct_len));
+    t5.add(std::to_string(dt_len));
+    t5.add(to_readable_bandwidth(io[1], t_single));
+    t5.add(to_readable_bandwidth(io[1], t_replicated));
+    t5.endOfRow();
+  }
+
+  t5.setAlignment(1, TextTable::Alignment::RIGHT);
+  t5.setAlignment(2, TextTable::Alignment::RIGHT);
+  t5.setAlignment(3, TextTable::Alignment::RIGHT);
+  t5.setAlignment(4, TextTable::Alignment::RIGHT);
+  std::cout << t5;
+
+  // per message latency, kernel launch per message vs. persistent kernel
+  std::cout << std::endl
+            << "Benchmarking single message Acorn-128 encrypt latency"
+            << std::endl
+            << std::endl;
+
+  TextTable t6('-', '|', '+');
+
+  t6.add("plain text len ( bytes )");
+  t6.add("associated data len ( bytes )");
+  t6.add("kernel per message ( us )");
+  t6.add("persistent kernel ( us )");
+  t6.endOfRow();
+
+  for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 2) {
+    using namespace bench_acorn_fpga;
+
+    acorn_usm::pool_t pool{ q, sycl::usm::alloc::device };
+
+    const uint64_t t_launch =
+      exec_small_batches(q, ct_len, dt_len, 1, rounds, &pool);
+    const uint64_t t_persist = exec_persistent(q, ct_len, dt_len, rounds);
+
+    t6.add(std::to_string(ct_len));
+    t6.add(std::to_string(dt_len));
+    t6.add(std::to_string(static_cast<double>(t_launch) * 1e-3));
+    t6.add(std::to_string(static_cast<double>(t_persist) * 1e-3));
+    t6.endOfRow();
+  }
+
+  t6.setAlignment(0, TextTable::Alignment::RIGHT);
+  t6.setAlignment(1, TextTable::Alignment::RIGHT);
+  t6.setAlignment(2, TextTable::Alignment::RIGHT);
+  t6.setAlignment(3, TextTable::Alignment::RIGHT);
+  std::cout << t6;
+
+  // kernel bandwidth, single kernel vs. reader/ compute/ writer kernels
+  // connected by pipes vs. 512 -bit line accessing kernel, all specialized on
+  // compile-time known byte lengths
+  std::cout << std::endl
+            << "Benchmarking Acorn-128 encrypt, single vs. piped vs. burst"
+            << std::endl
+            << std::endl;
+
+  TextTable t7('-', '|', '+');
+
+  t7.add("invocation count");
+  t7.add("plain text len ( bytes )");
+  t7.add("associated data len ( bytes )");
+  t7.add("single kernel b/w");
+  t7.add("piped kernels b/w");
+  t7.add("burst kernel b/w");
+  t7.endOfRow();
+
+  fixed_row<min_ct_len, dt_len>(q, max_invk_cnt, t7);
+  fixed_row<min_ct_len << 2, dt_len>(q, max_invk_cnt, t7);
+  fixed_row<min_ct_len << 4, dt_len>(q, max_invk_cnt, t7);
+  fixed_row<max_ct_len, dt_len>(q, max_invk_cnt, t7);
+
+  t7.setAlignment(1, TextTable::Alignment::RIGHT);
+  t7.setAlignment(2, TextTable::Alignment::RIGHT);
+  t7.setAlignment(3, TextTable::Alignment::RIGHT);
+  t7.setAlignment(4, TextTable::Alignment::RIGHT);
+  t7.setAlignment(5, TextTable::Alignment::RIGHT);
+  std::cout << t7;
+
   std::free(ts);
   std::free(io);
 
@@ -0,0 +1,134 @@
+#include "bench_sycl_utils.hpp"
+#include "table.hpp"
+#include <iostream>
+
+// Inputs are generated on device, so that kernel throughput isn't bounded by
+// host; define `HOST_INPUTS` for end-to-end numbers, with inputs generated on
+// host & shipped to device
+#if defined HOST_INPUTS
+constexpr auto input_from = bench_acorn_sycl::input_src::host_gen;
+constexpr const char* input_col = "host-to-device b/w";
+#else
+constexpr auto input_from = bench_acorn_sycl::input_src::device_gen;
+constexpr const char* input_col = "input generation b/w";
+#endif
+
+int
+main()
+{
+  // associated data byte length, same for all cases
+  constexpr size_t dt_len = 32ul;
+  // min # -of work-items ( one per message ) of ND-range Acorn kernel
+  constexpr size_t min_invk_cnt = 1ul << 16;
+  // max # -of work-items ( one per message ) of ND-range Acorn kernel
+  constexpr size_t max_invk_cnt = 1ul << 18;
+  // # -of work-items per work-group of ND-range Acorn kernel
+  constexpr size_t wg_size = 64ul;
+  constexpr size_t min_ct_len = 64ul;   // bytes
+  constexpr size_t max_ct_len = 4096ul; // bytes
+
+  sycl::cpu_selector s{};
+
+  sycl::device d{ s };
+  sycl::context c{ d };
+  sycl::queue q{ c, d, sycl::property::queue::enable_profiling{} };
+
+  std::cout << "running on " << d.get_info<sycl::info::device::name>()
+            << std::endl
+            << std::endl;
+
+  uint64_t* ts = static_cast<uint64_t*>(std::malloc(sizeof(uint64_t) * 3));
+  size_t* io = static_cast<size_t*>(std::malloc(sizeof(size_t) * 3));
+
+  std::cout << "Benchmarking Acorn-128 ND-range encrypt" << std::endl
+            << std::endl;
+
+  TextTable t0('-', '|', '+');
+
+  t0.add("work-item count");
+  t0.add("plain text len ( bytes )");
+  t0.add("associated data len ( bytes )");
+  t0.add(input_col);
+  t0.add("kernel b/w");
+  t0.add("device-to-host b/w");
+  t0.endOfRow();
+
+  for (size_t invk = min_invk_cnt; invk <= max_invk_cnt; invk <<= 1) {
+    for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 1) {
+      bench_acorn_sycl::exec_kernel(q,
+                                    ct_len,
+                                    dt_len,
+                                    invk,
+                                    bench_acorn_sycl::acorn_type::acorn_encrypt,
+                                    ts,
+                                    io,
+                                    wg_size,
+                                    bench_acorn_sycl::host_mem_type::pageable,
+                                    input_from);
+
+      t0.add(std::to_string(invk));
+      t0.add(std::to_string(ct_len));
+      t0.add(std::to_string(dt_len));
+      t0.add(bench_acorn_sycl::to_readable_bandwidth(io[0], ts[0]));
+      t0.add(bench_acorn_sycl::to_readable_bandwidth(io[1], ts[1]));
+      t0.add(bench_acorn_sycl::to_readable_bandwidth(io[2], ts[2]));
+      t0.endOfRow();
+    }
+  }
+
+  t0.setAlignment(1, TextTable::Alignment::RIGHT);
+  t0.setAlignment(2, TextTable::Alignment::RIGHT);
+  t0.setAlignment(3, TextTable::Alignment::RIGHT);
+  t0.setAlignment(4, TextTable::Alignment::RIGHT);
+  t0.setAlignment(5, TextTable::Alignment::RIGHT);
+  std::cout << t0;
+
+  std::cout << std::endl
+            << "Benchmarking Acorn-128 ND-range decrypt" << std::endl
+            << std::endl;
+
+  TextTable t1('-', '|', '+');
+
+  t1.add("work-item count");
+  t1.add("cipher text len ( bytes )");
+  t1.add("associated data len ( bytes )");
+  t1.add(input_col);
+  t1.add("kernel b/w");
+  t1.add("device-to-host b/w");
+  t1.endOfRow();
+
+  for (size_t invk = min_invk_cnt; invk <= max_invk_cnt; invk <<= 1) {
+    for (size_t ct_len = min_ct_len; ct_len <= max_ct_len; ct_len <<= 1) {
+      bench_acorn_sycl::exec_kernel(q,
+                                    ct_len,
+                                    dt_len,
+                                    invk,
+                                    bench_acorn_sycl::acorn_type::acorn_decrypt,
+                                    ts,
+                                    io,
+                                    wg_size,
+                                    bench_acorn_sycl::host_mem_type::pageable,
+                                    input_from);
+
+      t1.add(std::to_string(invk));
+      t1.add(std::to_string(ct_len));
+      t1.add(std::to_string(dt_len));
+      t1.add(bench_acorn_sycl::to_readable_bandwidth(io[0], ts[0]));
+      t1.add(bench_acorn_sycl::to_readable_bandwidth(io[1], ts[1]));
+      t1.add(bench_acorn_sycl::to_readable_bandwidth(io[2], ts[2]));
+      t1.endOfRow();
+    }
+  }
+
+  t1.setAlignment(1, TextTable::Alignment::RIGHT);
+  t1.setAlignment(2, TextTable::Alignment::RIGHT);
+  t1.setAlignment(3, TextTable::Alignment::RIGHT);
+  t1.setAlignment(4, TextTable::Alignment::RIGHT);
+  t1.setAlignment(5, TextTable::Alignment::RIGHT);
+  std::cout << t1;
+
+  std::free(ts);
+  std::free(io);
+
+  return EXIT_SUCCESS;
+}
@@ -10,18 +10,19 @@ namespace acorn {
 // this routine computes `c_len` -bytes encrypted text along with 128 -bit
 // authentication tag
 //
-// Note, assert t_len == c_len
+// Note, assert t_len == c_len; `text` & `cipher` may be same buffer, see
+// `encrypt_inplace`
 //
 // See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
 static inline void
 encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
         const uint8_t* const __restrict nonce, // 128 -bit message nonce
-        const uint8_t* const __restrict text,  // plain text
+        const uint8_t* const text,             // plain text
         const size_t ct_len,                   // len(text), len(cipher)
         const uint8_t* const __restrict data,  // associated data bytes
         const size_t d_len,                    // len(data)
-        uint8_t* const __restrict cipher,      // encrypted bytes
+        uint8_t* const cipher,                 // encrypted bytes
         uint8_t* const __restrict tag          // 128 -bit authentication tag
 )
 {
@@ -46,7 +47,8 @@ encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
 //
 // Always ensure `assert f`, otherwise something is off !
 //
-// Note, assert c_len == t_len
+// Note, assert c_len == t_len; `cipher` & `text` may be same buffer, see
+// `decrypt_inplace`
 //
 // See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
@@ -54,11 +56,11 @@ static inline bool
 decrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
         const uint8_t* const __restrict nonce,  // 128 -bit message nonce
         const uint8_t* const __restrict tag,    // 128 -bit authentication tag
-        const uint8_t* const __restrict cipher, // encrypted bytes
+        const uint8_t* const cipher,            // encrypted bytes
         const size_t ct_len,                    // len(cipher), len(text)
         const uint8_t* const __restrict data,   // associated data bytes
         const size_t d_len,                     // len(data)
-        uint8_t* const __restrict text          // decrypted bytes
+        uint8_t* const text                     // decrypted bytes
 )
 {
   // 293 -bit Acorn-128 state, zero initialize
@@ -84,4 +86,193 @@ decrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
   return !fail;
 }
 
+// Acorn-128 authenticated encryption, same as `encrypt` ( see above ), but
+// byte lengths of plain text ( `ct_len` ) & associated data ( `d_len` ) are
+// compile-time constants, which are forwarded to runtime length routine; once
+// inlined, all of its loops have static trip counts & 8 -bit tail loops, with
+// zero trip count when lengths are multiples of 4, are compiled out
+//
+// Useful for fixed-size records, invoke as `acorn::encrypt<48, 16>(...)`;
+// also usable from inside FPGA kernels, see `acorn_fpga::encrypt`.
+template<const size_t ct_len, const size_t d_len>
+static inline void
+encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
+        const uint8_t* const __restrict nonce, // 128 -bit message nonce
+        const uint8_t* const __restrict text,  // plain text, `ct_len` -bytes
+        const uint8_t* const __restrict data,  // associated, `d_len` -bytes
+        uint8_t* const __restrict cipher,      // encrypted, `ct_len` -bytes
+        uint8_t* const __restrict tag          // 128 -bit authentication tag
+)
+{
+  encrypt(key, nonce, text, ct_len, data, d_len, cipher, tag);
+}
+
+// Acorn-128 verified decryption, same as `decrypt` ( see above ), but byte
+// lengths of cipher text ( `ct_len` ) & associated data ( `d_len` ) are
+// compile-time constants, forwarded to runtime length routine, same as
+// `encrypt<ct_len, d_len>` ( see above ) does
+//
+// Always ensure `assert f`, otherwise something is off !
+template<const size_t ct_len, const size_t d_len>
+static inline bool
+decrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
+        const uint8_t* const __restrict nonce,  // 128 -bit message nonce
+        const uint8_t* const __restrict tag,    // 128 -bit authentication tag
+        const uint8_t* const __restrict cipher, // encrypted, `ct_len` -bytes
+        const uint8_t* const __restrict data,   // associated, `d_len` -bytes
+        uint8_t* const __restrict text          // decrypted, `ct_len` -bytes
+)
+{
+  return decrypt(key, nonce, tag, cipher, ct_len, data, d_len, text);
+}
+
+// Acorn-128 authenticated encryption, performed in-place i.e. `ct_len` -bytes
+// plain text living in `buf` is overwritten by equal length encrypted text,
+// while 128 -bit authentication tag is written to `tag`
+//
+// Computes same encrypted bytes & authentication tag as `encrypt` does, but
+// without requiring a separate output buffer. Note, `buf` must not overlap
+// with any of `key`, `nonce`, `data` or `tag`.
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline void
+encrypt_inplace(const uint8_t* const __restrict key,   // 128 -bit secret key
+                const uint8_t* const __restrict nonce, // 128 -bit message nonce
+                uint8_t* const __restrict buf,  // plain text -> encrypted text
+                const size_t ct_len,            // len(buf)
+                const uint8_t* const __restrict data, // associated data bytes
+                const size_t d_len,                   // len(data)
+                uint8_t* const __restrict tag // 128 -bit authentication tag
+)
+{
+  encrypt(key, nonce, buf, ct_len, data, d_len, buf, tag);
+}
+
+// Acorn-128 verified decryption, performed in-place i.e. `ct_len` -bytes
+// encrypted text living in `buf` is overwritten by equal length decrypted
+// text, returning boolean verification flag `f`
+//
+// Computes same decrypted bytes & verification flag as `decrypt` does, but
+// without requiring a separate output buffer. Note, `buf` must not overlap
+// with any of `key`, `nonce`, `data` or `tag`.
+//
+// When verification fails, `buf` still holds ( unverified ) decrypted bytes,
+// while encrypted bytes are lost; so always ensure `assert f`, before consuming
+// decrypted bytes !
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline bool
+decrypt_inplace(const uint8_t* const __restrict key,   // 128 -bit secret key
+                const uint8_t* const __restrict nonce, // 128 -bit message nonce
+                const uint8_t* const __restrict tag,   // 128 -bit auth tag
+                uint8_t* const __restrict buf, // encrypted -> decrypted text
+                const size_t ct_len,           // len(buf)
+                const uint8_t* const __restrict data, // associated data bytes
+                const size_t d_len                    // len(data)
+)
+{
+  return decrypt(key, nonce, tag, buf, ct_len, data, d_len, buf);
+}
+
+// Acorn-128 tag verification, given `ct_len` -bytes encrypted text, `d_len`
+// -bytes associated data, 128 -bit secret key, 128 -bit public message nonce &
+// 128 -bit authentication tag, this routine computes boolean verification flag
+// `f`, same as `decrypt` does, but without writing decrypted text anywhere
+//
+// Useful when encrypted text only needs to be authenticated & forwarded as is,
+// because it avoids both allocating output buffer & writing to it.
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline bool
+verify(const uint8_t* const __restrict key,    // 128 -bit secret key
+       const uint8_t* const __restrict nonce,  // 128 -bit message nonce
+       const uint8_t* const __restrict tag,    // 128 -bit authentication tag
+       const uint8_t* const __restrict cipher, // encrypted bytes
+       const size_t ct_len,                    // len(cipher)
+       const uint8_t* const __restrict data,   // associated data bytes
+       const size_t d_len                      // len(data)
+)
+{
+  // 293 -bit Acorn-128 state, zero initialize
+  uint64_t state[acorn_utils::LFSR_CNT] = { 0ul };
+  // 128 -bit authentication tag
+  uint8_t tag_[16];
+
+  // see section 1.3.3
+  acorn_utils::initialize(state, key, nonce);
+  // see section 1.3.4
+  acorn_utils::process_associated_data(state, data, d_len);
+  // see section 1.3.5
+  acorn_utils::absorb_cipher_text(state, cipher, ct_len);
+  // see section 1.3.6
+  acorn_utils::finalize(state, tag_);
+
+  // verification flag
+  bool fail = false;
+  // compare authentication tag byte-by-byte
+  for (size_t i = 0; i < 16; i++) {
+    fail |= (tag[i] ^ tag_[i]);
+  }
+  return !fail;
+}
+
+// Acorn-128 authenticated encryption or verified decryption, direction being
+// chosen at run-time using `dec`
+//
+// - when `dec` is false, `in` holds `ct_len` -bytes plain text, `out` receives
+// encrypted text & computed authentication tag is written to `tag`; always
+// returns true
+// - when `dec` is true, `in` holds `ct_len` -bytes encrypted text, `out`
+// receives decrypted text & authentication tag is read from `tag`; returns
+// boolean verification flag `f`, same as `decrypt` does
+//
+// Both directions go through same sequence of state updates ( see
+// `acorn_utils::process_text` ), which is what lets a single FPGA kernel serve
+// a batch of mixed encrypt/ decrypt requests, see `acorn_fpga::crypt`.
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline bool
+crypt(const uint8_t* const __restrict key,   // 128 -bit secret key
+      const uint8_t* const __restrict nonce, // 128 -bit message nonce
+      uint8_t* const __restrict tag,         // 128 -bit auth tag, out/ in
+      const uint8_t* const __restrict in,    // plain/ encrypted bytes
+      const size_t ct_len,                   // len(in), len(out)
+      const uint8_t* const __restrict data,  // associated data bytes
+      const size_t d_len,                    // len(data)
+      uint8_t* const __restrict out,         // encrypted/ decrypted bytes
+      const bool dec                         // decrypting `in` ?
+)
+{
+  // 293 -bit Acorn-128 state, zero initialize
+  uint64_t state[acorn_utils::LFSR_CNT] = { 0ul };
+  // 128 -bit authentication tag
+  uint8_t tag_[16];
+
+  // see section 1.3.3
+  acorn_utils::initialize(state, key, nonce);
+  // see section 1.3.4
+  acorn_utils::process_associated_data(state, data, d_len);
+  // see section 1.3.5
+  acorn_utils::process_text(state, in, out, ct_len, dec);
+  // see section 1.3.6
+  acorn_utils::finalize(state, tag_);
+
+  // verification flag
+  bool fail = false;
+  // compare authentication tag byte-by-byte, when decrypting, otherwise
+  // publish computed one
+  for (size_t i = 0; i < 16; i++) {
+    if (dec) {
+      fail |= (tag[i] ^ tag_[i]);
+    } else {
+      tag[i] = tag_[i];
+    }
+  }
+  return !fail;
+}
+
 }
@@ -0,0 +1,579 @@
+#pragma once
+#include "acorn_utils.hpp"
+#include <cstring>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ), bitsliced across 64 independent messages
+//
+// Each of 293 state bits is represented using one 64 -bit unsigned integer,
+// whose i-th bit ( read i-th lane ) belongs to i-th message. That way Acorn
+// functions `maj`, `ch`, `ksg128` & `fbk128` turn into plain bitwise
+// operations, computing same bit for 64 messages at once.
+namespace acorn_bitsliced {
+
+// These many independent messages are processed together, one per bit lane
+constexpr size_t LANE_CNT = 64ul;
+
+// Acorn-128 state is 293 -bit wide, see figure 1.1 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+constexpr size_t STATE_BITS = 293ul;
+
+// While updating state by 32 positions at a time, 32 more positions beyond
+// s_292 are written to ( see `state_update` ), before state is shifted
+constexpr size_t WINDOW_LEN = STATE_BITS + 32ul;
+
+// Bitsliced state lives in a window sliding over this many bit slices, so that
+// shifting state is just moving window ahead
+constexpr size_t BUF_LEN = 1024ul;
+
+// Bitsliced Acorn-128 state, where s_j of lane `i` lives in bit `i` of
+// `buf[off + j]`
+//
+// Positions beyond s_292 ( inside `buf` ) must always be zeroed.
+struct state_t
+{
+  uint64_t buf[BUF_LEN];
+  size_t off;
+};
+
+// Transposes 64 x 64 bit matrix in-place, such that after transposition bit `r`
+// of `mat[c]` holds what was bit `c` of `mat[r]`
+//
+// Adapted from figure 7-3 of Hacker's Delight ( 2nd edition )
+static inline void
+transpose(uint64_t* const mat)
+{
+  uint64_t m = 0x00000000fffffffful;
+
+  for (size_t j = 32; j > 0; j >>= 1, m ^= m << j) {
+    for (size_t k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+      const uint64_t t = ((mat[k] >> j) ^ mat[k | j]) & m;
+
+      mat[k] ^= t << j;
+      mat[k | j] ^= t;
+    }
+  }
+}
+
+// Reads `blen` ( <= 8 ) bytes, from offset `off` of each of 64 equal-length
+// byte slices ( each of length `len` -bytes, placed one after another ) &
+// transposes them into bit slices
+//
+// Bytes are read in same order as in `acorn_utils::process_*` routines i.e.
+// when `blen` is 8 or 4, they are interpreted as big endian 32 -bit words and
+// first word's bits land in slices [32, 64) while second one's in [0, 32);
+// otherwise byte `i` ( < `blen` ) lands in slices [8 * i, 8 * (i + 1))
+static inline void
+load_lanes(const uint8_t* const __restrict in, // 64 byte slices
+           const size_t len,                   // length of each byte slice
+           const size_t off,                   // read from this offset
+           const size_t blen,                  // read these many bytes
+           uint64_t* const __restrict blk      // 64 bit slices
+)
+{
+  using namespace acorn_utils;
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    const uint8_t* const ptr = in + i * len + off;
+
+    if (blen == 8) {
+      const uint64_t hi = static_cast<uint64_t>(from_be_bytes(ptr));
+      const uint64_t lo = static_cast<uint64_t>(from_be_bytes(ptr + 4));
+
+      blk[i] = (hi << 32) | lo;
+    } else if (blen == 4) {
+      blk[i] = static_cast<uint64_t>(from_be_bytes(ptr));
+    } else {
+      uint64_t word = 0ul;
+      for (size_t j = 0; j < blen; j++) {
+        word |= static_cast<uint64_t>(ptr[j]) << (j << 3);
+      }
+      blk[i] = word;
+    }
+  }
+
+  transpose(blk);
+}
+
+// Transposes 64 bit slices back & writes `blen` ( <= 8 ) bytes, to offset
+// `off` of each of 64 equal-length byte slices, following same byte order as
+// described on top of `load_lanes`
+//
+// Note, bit slices are clobbered !
+static inline void
+store_lanes(uint64_t* const __restrict blk, // 64 bit slices
+            const size_t len,               // length of each byte slice
+            const size_t off,               // write from this offset
+            const size_t blen,              // write these many bytes
+            uint8_t* const __restrict out   // 64 byte slices
+)
+{
+  transpose(blk);
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    uint8_t* const ptr = out + i * len + off;
+
+    if (blen == 8) {
+      acorn_utils::to_be_bytes(static_cast<uint32_t>(blk[i] >> 32), ptr);
+      acorn_utils::to_be_bytes(static_cast<uint32_t>(blk[i]), ptr + 4);
+    } else if (blen == 4) {
+      acorn_utils::to_be_bytes(static_cast<uint32_t>(blk[i]), ptr);
+    } else {
+      for (size_t j = 0; j < blen; j++) {
+        ptr[j] = static_cast<uint8_t>(blk[i] >> (j << 3));
+      }
+    }
+  }
+}
+
+// Moves bitsliced state window ahead by `bits` positions i.e. shifts whole
+// state; once window reaches end of buffer, live state bits are moved back to
+// beginning of buffer and everything beyond them is zeroed
+static inline void
+advance(state_t* const st, const size_t bits)
+{
+  st->off += bits;
+
+  if (st->off + WINDOW_LEN > BUF_LEN) {
+    uint64_t* const buf = st->buf;
+
+    std::memmove(buf, buf + st->off, STATE_BITS * sizeof(uint64_t));
+    std::memset(buf + STATE_BITS, 0, (BUF_LEN - STATE_BITS) * sizeof(uint64_t));
+    st->off = 0;
+  }
+}
+
+// Step 1 of state update function, defined in section 1.3.2 of Acorn
+// specification https://competitions.cr.yp.to/round3/acornv3.pdf, on bitsliced
+// state; mirrors `acorn_utils::update_lfsrs`
+template<const size_t bits>
+static inline void
+update_lfsrs(uint64_t* const s)
+{
+  for (size_t j = 0; j < bits; j++) {
+    s[289 + j] ^= s[235 + j] ^ s[230 + j];
+  }
+  for (size_t j = 0; j < bits; j++) {
+    s[230 + j] ^= s[196 + j] ^ s[193 + j];
+  }
+  for (size_t j = 0; j < bits; j++) {
+    s[193 + j] ^= s[160 + j] ^ s[154 + j];
+  }
+  for (size_t j = 0; j < bits; j++) {
+    s[154 + j] ^= s[111 + j] ^ s[107 + j];
+  }
+  for (size_t j = 0; j < bits; j++) {
+    s[107 + j] ^= s[66 + j] ^ s[61 + j];
+  }
+  for (size_t j = 0; j < bits; j++) {
+    s[61 + j] ^= s[23 + j] ^ s[0 + j];
+  }
+}
+
+// Generate key stream bit of 64 lanes, at position `j` of current step; see
+// `acorn_utils::ksg128`
+static inline uint64_t
+ksg128(const uint64_t* const s, const size_t j)
+{
+  using namespace acorn_utils;
+
+  const uint64_t w0 = maj(s[235 + j], s[61 + j], s[193 + j]);
+  const uint64_t w1 = ch(s[230 + j], s[111 + j], s[66 + j]);
+  return s[12 + j] ^ s[154 + j] ^ w0 ^ w1;
+}
+
+// Compute feedback bit of 64 lanes, at position `j` of current step; see
+// `acorn_utils::fbk128`
+static inline uint64_t
+fbk128(const uint64_t* const s, // bitsliced state window
+       const size_t j,          // position in current step
+       const uint64_t ca,       // control bit `a` of 64 lanes
+       const uint64_t cb,       // control bit `b` of 64 lanes
+       const uint64_t ks        // key stream bit of 64 lanes
+)
+{
+  using namespace acorn_utils;
+
+  const uint64_t w0 = maj(s[244 + j], s[23 + j], s[160 + j]);
+  const uint64_t w1 = cb & ks;
+  const uint64_t w2 = s[196 + j] & ca;
+  return s[j] ^ ~s[107 + j] ^ w0 ^ w1 ^ w2;
+}
+
+// Update bitsliced state by `bits` ( = 8 or 32 ) positions, absorbing message
+// bit slices `m` & writing generated key stream bit slices to `ks`; mirrors
+// `acorn_utils::state_update`, so that each lane ends up in same state as it'd
+// be after invoking that routine
+//
+// Control bits are same for all lanes, because all messages are of same length.
+template<const size_t bits>
+static inline void
+state_update(state_t* const __restrict st,      // bitsliced state
+             const uint64_t* const __restrict m, // `bits` -many slices
+             uint64_t* const __restrict ks,      // `bits` -many slices
+             const uint64_t ca,                  // control bits `a`
+             const uint64_t cb                   // control bits `b`
+)
+  requires((bits == 8) || (bits == 32))
+{
+  uint64_t* const s = st->buf + st->off;
+
+  // step 1
+  update_lfsrs<bits>(s);
+
+  for (size_t j = 0; j < bits; j++) {
+    // step 2
+    ks[j] = ksg128(s, j);
+    // step 3
+    const uint64_t fb = fbk128(s, j, ca, cb, ks[j]);
+    // step 4
+    s[293 + j] ^= fb ^ m[j];
+  }
+
+  advance(st, bits);
+}
+
+// Update bitsliced state by `bits` ( = 8 or 32 ) positions, while decrypting
+// encrypted bit slices `m_in` into `m_out`; mirrors decrypting variant of
+// `acorn_utils::state_update`
+template<const size_t bits>
+static inline void
+state_update_dec(state_t* const __restrict st,         // bitsliced state
+                 const uint64_t* const __restrict m_in, // `bits` -many slices
+                 uint64_t* const __restrict m_out,      // `bits` -many slices
+                 const uint64_t ca,                     // control bits `a`
+                 const uint64_t cb                      // control bits `b`
+)
+  requires((bits == 8) || (bits == 32))
+{
+  uint64_t* const s = st->buf + st->off;
+
+  // step 1
+  update_lfsrs<bits>(s);
+
+  for (size_t j = 0; j < bits; j++) {
+    // step 2
+    const uint64_t ks = ksg128(s, j);
+    m_out[j] = m_in[j] ^ ks;
+    // step 3
+    const uint64_t fb = fbk128(s, j, ca, cb, ks);
+    // step 4
+    s[293 + j] ^= fb ^ m_out[j];
+  }
+
+  advance(st, bits);
+}
+
+// Message bit slices, when each lane absorbs 32 -bit word `0`
+static constexpr uint64_t ZERO_WORD[32]{};
+
+// Message bit slices, when each lane absorbs 32 -bit word `1`
+static constexpr uint64_t ONE_WORD[32]{ acorn_utils::MAX_U64 };
+
+// Initialize bitsliced Acorn-128 state of 64 lanes; see
+// `acorn_utils::initialize`
+static inline void
+initialize(state_t* const __restrict st,        // bitsliced state
+           const uint8_t* const __restrict key, // 64 secret keys
+           const uint8_t* const __restrict iv   // 64 initialization vectors
+)
+{
+  using namespace acorn_utils;
+
+  std::memset(st, 0, sizeof(state_t));
+
+  uint64_t k01[64];
+  uint64_t k23[64];
+  uint64_t v01[64];
+  uint64_t v23[64];
+  uint64_t k0x[32]; // first key word, with first bit flipped
+  uint64_t ks[32];
+
+  load_lanes(key, 16, 0, 8, k01);
+  load_lanes(key, 16, 8, 8, k23);
+  load_lanes(iv, 16, 0, 8, v01);
+  load_lanes(iv, 16, 8, 8, v23);
+
+  std::memcpy(k0x, k01 + 32, sizeof(k0x));
+  k0x[0] = ~k0x[0];
+
+  const uint64_t* const kw[4] = { k01 + 32, k01, k23 + 32, k23 };
+
+  // --- step 2, 3, 4 ---
+  for (size_t i = 0; i < 4; i++) {
+    state_update<32>(st, kw[i], ks, MAX_U64, MAX_U64);
+  }
+
+  state_update<32>(st, v01 + 32, ks, MAX_U64, MAX_U64);
+  state_update<32>(st, v01, ks, MAX_U64, MAX_U64);
+  state_update<32>(st, v23 + 32, ks, MAX_U64, MAX_U64);
+  state_update<32>(st, v23, ks, MAX_U64, MAX_U64);
+
+  state_update<32>(st, k0x, ks, MAX_U64, MAX_U64);
+
+  for (size_t i = 1; i < 48; i++) {
+    state_update<32>(st, kw[i & 3], ks, MAX_U64, MAX_U64);
+  }
+  // --- step 2, 3, 4 ---
+}
+
+// Appends single `1` -bit, followed by `0` -bits, after associated data bits/
+// text bits; see `acorn_utils::process_{associated_data, plain_text}`
+static inline void
+append_padding(state_t* const st, const uint64_t cb)
+{
+  using namespace acorn_utils;
+
+  uint64_t ks[32];
+
+  state_update<32>(st, ONE_WORD, ks, MAX_U64, cb);
+
+  for (size_t i = 0; i < 4; i++) {
+    state_update<32>(st, ZERO_WORD, ks, MAX_U64, cb);
+  }
+
+  for (size_t i = 4; i < 8; i++) {
+    state_update<32>(st, ZERO_WORD, ks, MIN_U64, cb);
+  }
+}
+
+// Processing associated data bytes of 64 lanes; see
+// `acorn_utils::process_associated_data`
+static inline void
+process_associated_data(
+  state_t* const __restrict st,         // bitsliced state
+  const uint8_t* const __restrict data, // 64 associated data byte slices
+  const size_t data_len                 // len(data) of each lane, can be >= 0
+)
+{
+  using namespace acorn_utils;
+
+  const size_t u32_cnt = data_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = data_len % 4;  // remaining 8 -bit chunk count
+
+  uint64_t blk[64];
+  uint64_t ks[32];
+
+  for (size_t i = 0; i + 1 < u32_cnt; i += 2) {
+    load_lanes(data, data_len, i << 2, 8, blk);
+
+    state_update<32>(st, blk + 32, ks, MAX_U64, MAX_U64);
+    state_update<32>(st, blk, ks, MAX_U64, MAX_U64);
+  }
+
+  if (u32_cnt & 1) {
+    load_lanes(data, data_len, (u32_cnt - 1) << 2, 4, blk);
+    state_update<32>(st, blk, ks, MAX_U64, MAX_U64);
+  }
+
+  if (u08_cnt > 0) {
+    load_lanes(data, data_len, u32_cnt << 2, u08_cnt, blk);
+
+    for (size_t i = 0; i < u08_cnt; i++) {
+      state_update<8>(st, blk + (i << 3), ks, MAX_U64, MAX_U64);
+    }
+  }
+
+  append_padding(st, MAX_U64);
+}
+
+// Encrypts plain text bytes of 64 lanes; see `acorn_utils::process_plain_text`
+static inline void
+process_plain_text(state_t* const __restrict st,         // bitsliced state
+                   const uint8_t* const __restrict text, // 64 plain texts
+                   uint8_t* const __restrict cipher,     // 64 cipher texts
+                   const size_t ct_len // length of each lane, can be >= 0
+)
+{
+  using namespace acorn_utils;
+
+  const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
+
+  uint64_t blk[64];
+  uint64_t ks[64];
+
+  for (size_t i = 0; i + 1 < u32_cnt; i += 2) {
+    load_lanes(text, ct_len, i << 2, 8, blk);
+
+    state_update<32>(st, blk + 32, ks + 32, MAX_U64, MIN_U64);
+    state_update<32>(st, blk, ks, MAX_U64, MIN_U64);
+
+    for (size_t j = 0; j < 64; j++) {
+      blk[j] ^= ks[j];
+    }
+    store_lanes(blk, ct_len, i << 2, 8, cipher);
+  }
+
+  if (u32_cnt & 1) {
+    load_lanes(text, ct_len, (u32_cnt - 1) << 2, 4, blk);
+    state_update<32>(st, blk, ks, MAX_U64, MIN_U64);
+
+    for (size_t j = 0; j < 32; j++) {
+      blk[j] ^= ks[j];
+    }
+    store_lanes(blk, ct_len, (u32_cnt - 1) << 2, 4, cipher);
+  }
+
+  if (u08_cnt > 0) {
+    load_lanes(text, ct_len, u32_cnt << 2, u08_cnt, blk);
+
+    for (size_t i = 0; i < u08_cnt; i++) {
+      state_update<8>(st, blk + (i << 3), ks + (i << 3), MAX_U64, MIN_U64);
+    }
+
+    for (size_t j = 0; j < (u08_cnt << 3); j++) {
+      blk[j] ^= ks[j];
+    }
+    store_lanes(blk, ct_len, u32_cnt << 2, u08_cnt, cipher);
+  }
+
+  append_padding(st, MIN_U64);
+}
+
+// Decrypts cipher text bytes of 64 lanes; see
+// `acorn_utils::process_cipher_text`
+static inline void
+process_cipher_text(state_t* const __restrict st,           // bitsliced state
+                    const uint8_t* const __restrict cipher, // 64 cipher texts
+                    uint8_t* const __restrict text,         // 64 plain texts
+                    const size_t ct_len // length of each lane, can be >= 0
+)
+{
+  using namespace acorn_utils;
+
+  const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
+
+  uint64_t blk[64];
+  uint64_t dec[64];
+
+  for (size_t i = 0; i + 1 < u32_cnt; i += 2) {
+    load_lanes(cipher, ct_len, i << 2, 8, blk);
+
+    state_update_dec<32>(st, blk + 32, dec + 32, MAX_U64, MIN_U64);
+    state_update_dec<32>(st, blk, dec, MAX_U64, MIN_U64);
+
+    store_lanes(dec, ct_len, i << 2, 8, text);
+  }
+
+  if (u32_cnt & 1) {
+    load_lanes(cipher, ct_len, (u32_cnt - 1) << 2, 4, blk);
+    state_update_dec<32>(st, blk, dec, MAX_U64, MIN_U64);
+
+    store_lanes(dec, ct_len, (u32_cnt - 1) << 2, 4, text);
+  }
+
+  if (u08_cnt > 0) {
+    load_lanes(cipher, ct_len, u32_cnt << 2, u08_cnt, blk);
+
+    for (size_t i = 0; i < u08_cnt; i++) {
+      const size_t off = i << 3;
+      state_update_dec<8>(st, blk + off, dec + off, MAX_U64, MIN_U64);
+    }
+
+    store_lanes(dec, ct_len, u32_cnt << 2, u08_cnt, text);
+  }
+
+  append_padding(st, MIN_U64);
+}
+
+// Finalize bitsliced Acorn-128, generating 128 -bit authentication tag for
+// each of 64 lanes; see `acorn_utils::finalize`
+static inline void
+finalize(state_t* const __restrict st, // bitsliced state
+         uint8_t* const __restrict tag // 64 authentication tags
+)
+{
+  using namespace acorn_utils;
+
+  uint64_t ks[64];
+
+  for (size_t i = 0; i < 20; i++) {
+    state_update<32>(st, ZERO_WORD, ks, MAX_U64, MAX_U64);
+  }
+
+  // take last 128 keystream bits & interpret it as authentication tag
+  for (size_t i = 0; i < 2; i++) {
+    state_update<32>(st, ZERO_WORD, ks + 32, MAX_U64, MAX_U64);
+    state_update<32>(st, ZERO_WORD, ks, MAX_U64, MAX_U64);
+
+    store_lanes(ks, 16, i << 3, 8, tag);
+  }
+}
+
+// Bitsliced Acorn-128 authenticated encryption of 64 independent messages,
+// each with `ct_len` -bytes plain text & `d_len` -bytes associated data,
+// producing exactly same encrypted text & 128 -bit authentication tag, as
+// `acorn::encrypt` would, for each of them
+//
+// Message `i` ( < 64 ) lives at following offsets
+//
+// - secret key       : key + i * 16
+// - public nonce     : nonce + i * 16
+// - plain text       : text + i * ct_len
+// - associated data  : data + i * d_len
+// - encrypted text   : cipher + i * ct_len
+// - auth tag         : tag + i * 16
+//
+// Note, avoid nonce reuse i.e. don't use same nonce twice with same secret key
+static inline void
+encrypt(const uint8_t* const __restrict key,   // 64 secret keys
+        const uint8_t* const __restrict nonce, // 64 message nonces
+        const uint8_t* const __restrict text,  // 64 plain texts
+        const size_t ct_len,                   // len(text), len(cipher)
+        const uint8_t* const __restrict data,  // 64 associated data
+        const size_t d_len,                    // len(data)
+        uint8_t* const __restrict cipher,      // 64 encrypted texts
+        uint8_t* const __restrict tag          // 64 authentication tags
+)
+{
+  state_t st;
+
+  initialize(&st, key, nonce);
+  process_associated_data(&st, data, d_len);
+  process_plain_text(&st, text, cipher, ct_len);
+  finalize(&st, tag);
+}
+
+// Bitsliced Acorn-128 verified decryption of 64 independent messages, each
+// with `ct_len` -bytes encrypted text & `d_len` -bytes associated data,
+// producing exactly same decrypted text & verification flag, as
+// `acorn::decrypt` would, for each of them
+//
+// Memory layout is same as described on top of `encrypt`, while `i` -th
+// verification flag is written to `flag[i]`.
+//
+// Always ensure `assert flag[i]`, before consuming `i` -th decrypted text !
+static inline void
+decrypt(const uint8_t* const __restrict key,    // 64 secret keys
+        const uint8_t* const __restrict nonce,  // 64 message nonces
+        const uint8_t* const __restrict tag,    // 64 authentication tags
+        const uint8_t* const __restrict cipher, // 64 encrypted texts
+        const size_t ct_len,                    // len(cipher), len(text)
+        const uint8_t* const __restrict data,   // 64 associated data
+        const size_t d_len,                     // len(data)
+        uint8_t* const __restrict text,         // 64 decrypted texts
+        bool* const __restrict flag             // 64 verification flags
+)
+{
+  state_t st;
+  uint8_t tag_[LANE_CNT << 4];
+
+  initialize(&st, key, nonce);
+  process_associated_data(&st, data, d_len);
+  process_cipher_text(&st, cipher, text, ct_len);
+  finalize(&st, tag_);
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    const size_t t_off = i << 4;
+
+    bool fail = false;
+    for (size_t j = 0; j < 16; j++) {
+      fail |= static_cast<bool>(tag[t_off + j] ^ tag_[t_off + j]);
+    }
+    flag[i] = !fail;
+  }
+}
+
+}
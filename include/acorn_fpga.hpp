@@ -11,6 +11,39 @@ namespace acorn_fpga {
 class kernelAcorn128Encrypt;
 class kernelAcorn128Decrypt;
 
+// Same as above, but for kernels specialized on compile-time known per
+// invocation byte lengths of plain/ cipher text & associated data
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128EncryptFixed;
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128DecryptFixed;
+
+// Same as above, but for kernels working on messages of varying length
+class kernelAcorn128EncryptRagged;
+class kernelAcorn128DecryptRagged;
+
+// Same as above, but for kernels looking up secret keys in a key table, using
+// per message key index of type `idx_t`
+template<typename idx_t>
+class kernelAcorn128EncryptKeyed;
+template<typename idx_t>
+class kernelAcorn128DecryptKeyed;
+
+// Same as above, but for kernels deriving per message nonce on device
+class kernelAcorn128EncryptDerived;
+class kernelAcorn128DecryptDerived;
+
+// Same as above, but for decrypt kernel emitting bit-packed verification flags
+class kernelAcorn128DecryptPacked;
+
+// Same as above, but for unified kernel, which either encrypts or decrypts each
+// message, as requested
+class kernelAcorn128Crypt;
+
+// Maximum # -of secret keys, a key table can hold, so that whole table fits in
+// on-chip memory of kernel ( 256 keys x 16 -bytes = 4 KB )
+constexpr size_t MAX_KEY_CNT = 256ul;
+
 // Acorn-128 authenticated encryption on FPGA
 //
 // When N -many equal length plain text byte slices along with N -many equal
@@ -180,4 +213,825 @@ decrypt(
   return evt;
 }
 
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt` ( see above ),
+// but per invocation byte lengths of plain text ( `ct_len` ) & associated
+// data ( `d_len` ) are compile-time constants, so that this routine invokes
+// `acorn::encrypt<ct_len, d_len>`, whose loops have static trip counts ( which
+// can be fully unrolled/ pipelined during synthesis ) & where 8 -bit tail paths
+// are compiled out when lengths are multiples of 4.
+//
+// Invoke as `acorn_fpga::encrypt<64, 64>(...)`, with same arguments as
+// runtime length variant.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t ct_len, const size_t d_len>
+static inline sycl::event
+encrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // = invk_cnt * ct_len
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // = invk_cnt * d_len
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(invk_cnt * ct_len == text_len);
+  assert(invk_cnt * d_len == data_len);
+  assert(text_len == enc_len);
+
+  using kernel_t = kernelAcorn128EncryptFixed<ct_len, d_len>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * ct_len;
+        const size_t add_off = i * d_len;
+
+        acorn::encrypt<ct_len, d_len>(key + knt_off,
+                                      nonce + knt_off,
+                                      text + ct_off,
+                                      data + add_off,
+                                      enc + ct_off,
+                                      tag + knt_off);
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see above ), but
+// per invocation byte lengths of encrypted text ( `ct_len` ) & associated data
+// ( `d_len` ) are compile-time constants, so that this routine invokes
+// `acorn::decrypt<ct_len, d_len>`, whose loops have static trip counts ( which
+// can be fully unrolled/ pipelined during synthesis ) & where 8 -bit tail paths
+// are compiled out when lengths are multiples of 4.
+//
+// Invoke as `acorn_fpga::decrypt<64, 64>(...)`, with same arguments as
+// runtime length variant.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t ct_len, const size_t d_len>
+static inline sycl::event
+decrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // = invk_cnt * ct_len
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // = invk_cnt * d_len
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(invk_cnt * ct_len == enc_len);
+  assert(invk_cnt * d_len == data_len);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  using kernel_t = kernelAcorn128DecryptFixed<ct_len, d_len>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * ct_len;
+        const size_t add_off = i * d_len;
+
+        const bool flg = acorn::decrypt<ct_len, d_len>(key + knt_off,
+                                                       nonce + knt_off,
+                                                       tag + knt_off,
+                                                       enc + ct_off,
+                                                       data + add_off,
+                                                       text + ct_off);
+
+        flag[i] = flg;
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt` ( see above ),
+// but N -many plain text & associated data byte slices can be of varying
+// length, so that a batch doesn't need to be padded to its longest message
+//
+// Text & associated data slices are packed back to back, while their
+// boundaries are described using CSR-style offset arrays, each holding N + 1
+// entries ( residing in device accessible memory ), such that `i` -th plain
+// text slice lives in [text_off[i], text_off[i + 1]) of `text` ( also where
+// its encrypted bytes are written in `enc` ) & `i` -th associated data slice
+// lives in [data_off[i], data_off[i + 1]) of `data`. Also text_off[0] =
+// data_off[0] = 0, while text_off[N] = text_len & data_off[N] = data_len.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+encrypt_ragged(
+  sycl::queue& q,                          // SYCL job submission queue
+  const uint8_t* const __restrict key,     // secret keys
+  const size_t key_len,                    // = invk_cnt * 16
+  const uint8_t* const __restrict nonce,   // public nonces
+  const size_t nonce_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict text,    // plain text
+  const size_t text_len,                   // = text_off[invk_cnt]
+  const size_t* const __restrict text_off, // invk_cnt + 1 text offsets
+  const uint8_t* const __restrict data,    // associated data
+  [[maybe_unused]] const size_t data_len,  // = data_off[invk_cnt]
+  const size_t* const __restrict data_off, // invk_cnt + 1 data offsets
+  uint8_t* const __restrict enc,           // encrypted data bytes
+  const size_t enc_len,                    // = text_len
+  uint8_t* const __restrict tag,           // authentication tags
+  const size_t tag_len,                    // = invk_cnt * 16
+  const size_t invk_cnt,                   // to be invoked these many times
+  const std::vector<sycl::event> evts      // SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len == enc_len);
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128EncryptRagged>([=
+    ]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = text_off[i];
+        const size_t add_off = data_off[i];
+
+        acorn::encrypt(key + knt_off,
+                       nonce + knt_off,
+                       text + ct_off,
+                       text_off[i + 1] - ct_off,
+                       data + add_off,
+                       data_off[i + 1] - add_off,
+                       enc + ct_off,
+                       tag + knt_off);
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see above ), but
+// N -many encrypted text & associated data byte slices can be of varying
+// length, whose boundaries are described using CSR-style offset arrays, laid
+// out same as in `encrypt_ragged` ( see above )
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+decrypt_ragged(
+  sycl::queue& q,                          // SYCL job submission queue
+  const uint8_t* const __restrict key,     // secret keys
+  const size_t key_len,                    // = invk_cnt * 16
+  const uint8_t* const __restrict nonce,   // public nonces
+  const size_t nonce_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict tag,     // authentication tags
+  const size_t tag_len,                    // = invk_cnt * 16
+  const uint8_t* const __restrict enc,     // encrypted data bytes
+  const size_t enc_len,                    // = enc_off[invk_cnt]
+  const size_t* const __restrict enc_off,  // invk_cnt + 1 text offsets
+  const uint8_t* const __restrict data,    // associated data
+  [[maybe_unused]] const size_t data_len,  // = data_off[invk_cnt]
+  const size_t* const __restrict data_off, // invk_cnt + 1 data offsets
+  uint8_t* const __restrict text,          // plain text bytes
+  const size_t text_len,                   // = enc_len
+  bool* const __restrict flag,             // verification flags
+  const size_t flag_len,                   // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                   // to be invoked these many times
+  const std::vector<sycl::event> evts      // SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128DecryptRagged>([=
+    ]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = enc_off[i];
+        const size_t add_off = data_off[i];
+
+        const bool flg = acorn::decrypt(key + knt_off,
+                                        nonce + knt_off,
+                                        tag + knt_off,
+                                        enc + ct_off,
+                                        enc_off[i + 1] - ct_off,
+                                        data + add_off,
+                                        data_off[i + 1] - add_off,
+                                        text + ct_off);
+
+        flag[i] = flg;
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt` ( see above ),
+// but instead of N -many secret keys, it takes a small key table of K -many
+// secret keys ( K <= MAX_KEY_CNT ) & N -many key indices ( each of type u16 or
+// u32 ), so that `i` -th message is encrypted using `key_idx[i]` -th key
+//
+// When many messages share a handful of keys, this cuts host -> device
+// transfer of 16 -bytes per message down to 2 or 4 -bytes, while kernel copies
+// whole key table into on-chip memory before processing any message.
+//
+// A message whose key index is >= K is never encrypted under a garbage key;
+// instead its encrypted bytes & authentication tag are zeroed, so that it
+// fails verification, when decrypted.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<typename idx_t>
+static inline sycl::event
+encrypt_keyed(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret key table
+  const size_t key_len,                  // = key_cnt * 16
+  const idx_t* const __restrict key_idx, // key index, per message
+  const size_t key_idx_len,              // = invk_cnt * sizeof(idx_t)
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // SYCL runtime dependency graph
+)
+{
+  static_assert(std::is_same_v<idx_t, uint16_t> ||
+                  std::is_same_v<idx_t, uint32_t>,
+                "key index must be u16 or u32");
+
+  assert(key_len % 16 == 0);
+  assert(key_len > 0 && (key_len >> 4) <= MAX_KEY_CNT);
+  assert(invk_cnt * sizeof(idx_t) == key_idx_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(text_len == enc_len);
+
+  const size_t per_invk_ct_len = text_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  const size_t key_cnt = key_len >> 4;
+
+  using kernel_t = kernelAcorn128EncryptKeyed<idx_t>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      [[intel::fpga_memory]] uint8_t key_tbl[MAX_KEY_CNT << 4];
+
+      for (size_t i = 0; i < key_len; i++) {
+        key_tbl[i] = key[i];
+      }
+
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        // out of range index is masked to 0 -th key, so table is never read
+        // past its populated entries, while result is zeroed below
+        const size_t idx = static_cast<size_t>(key_idx[i]);
+        const bool ok = idx < key_cnt;
+        const size_t key_off = (ok ? idx : 0ul) << 4;
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        acorn::encrypt(key_tbl + key_off,
+                       nonce + knt_off,
+                       text + ct_off,
+                       per_invk_ct_len,
+                       data + add_off,
+                       per_invk_dt_len,
+                       enc + ct_off,
+                       tag + knt_off);
+
+        if (!ok) {
+          for (size_t j = 0; j < per_invk_ct_len; j++) {
+            enc[ct_off + j] = 0;
+          }
+          for (size_t j = 0; j < 16; j++) {
+            tag[knt_off + j] = 0;
+          }
+        }
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see above ), but
+// secret keys are looked up in a small key table, using per message key index,
+// same as `encrypt_keyed` ( see above ) does
+//
+// A message whose key index is >= K fails verification, i.e. its flag is set
+// to false, same as it's done for a forged message.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<typename idx_t>
+static inline sycl::event
+decrypt_keyed(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret key table
+  const size_t key_len,                  // = key_cnt * 16
+  const idx_t* const __restrict key_idx, // key index, per message
+  const size_t key_idx_len,              // = invk_cnt * sizeof(idx_t)
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // SYCL runtime dependency graph
+)
+{
+  static_assert(std::is_same_v<idx_t, uint16_t> ||
+                  std::is_same_v<idx_t, uint32_t>,
+                "key index must be u16 or u32");
+
+  assert(key_len % 16 == 0);
+  assert(key_len > 0 && (key_len >> 4) <= MAX_KEY_CNT);
+  assert(invk_cnt * sizeof(idx_t) == key_idx_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  const size_t per_invk_ct_len = enc_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  const size_t key_cnt = key_len >> 4;
+
+  using kernel_t = kernelAcorn128DecryptKeyed<idx_t>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      [[intel::fpga_memory]] uint8_t key_tbl[MAX_KEY_CNT << 4];
+
+      for (size_t i = 0; i < key_len; i++) {
+        key_tbl[i] = key[i];
+      }
+
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        // out of range index is masked to 0 -th key & its flag is cleared
+        const size_t idx = static_cast<size_t>(key_idx[i]);
+        const bool ok = idx < key_cnt;
+        const size_t key_off = (ok ? idx : 0ul) << 4;
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        const bool flg = acorn::decrypt(key_tbl + key_off,
+                                        nonce + knt_off,
+                                        tag + knt_off,
+                                        enc + ct_off,
+                                        per_invk_ct_len,
+                                        data + add_off,
+                                        per_invk_dt_len,
+                                        text + ct_off);
+
+        flag[i] = flg && ok;
+      }
+    });
+  });
+  return evt;
+}
+
+// 128 -bit base nonce, captured by value in kernels deriving per message nonce,
+// where first 96 -bits identify connection & last 32 -bits hold big endian
+// sequence number
+struct nonce_base_t
+{
+  uint8_t bytes[16];
+};
+
+// Derives 128 -bit nonce of a message, by keeping first 96 -bits of base nonce
+// & replacing last 32 -bits with big endian `ctr`
+static inline void
+derive_nonce(const nonce_base_t& base,
+             const uint32_t ctr,
+             uint8_t* const __restrict nonce)
+{
+  for (size_t i = 0; i < 12; i++) {
+    nonce[i] = base.bytes[i];
+  }
+  acorn_utils::to_be_bytes(ctr, nonce + 12);
+}
+
+// Sequence number of `i` -th message, which is either `ctr[i]` ( when compact
+// per message counter array is given ) or sequence number of base nonce + i (
+// caller ensures this never exceeds 2 ^ 32 - 1, see `fits_sequence_space` )
+static inline uint32_t
+sequence_number(const nonce_base_t& base,
+                const uint32_t* const __restrict ctr,
+                const size_t i)
+{
+  if (ctr != nullptr) {
+    return ctr[i];
+  }
+  return acorn_utils::from_be_bytes(base.bytes + 12) + static_cast<uint32_t>(i);
+}
+
+// Whether `invk_cnt` -many messages can be given sequence numbers base + i,
+// where base is last 32 -bits of base nonce ( read as big endian ), without
+// running past 2 ^ 32 - 1 & so reusing nonces of same batch
+static inline bool
+fits_sequence_space(const uint8_t* const __restrict base_nonce,
+                    const size_t invk_cnt)
+{
+  const uint64_t seq = acorn_utils::from_be_bytes(base_nonce + 12);
+  return seq + invk_cnt <= (1ul << 32);
+}
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt` ( see above ),
+// but instead of N -many explicit nonces, kernel derives nonce of each message
+// on device, from a 128 -bit base nonce ( see `derive_nonce` ) & either
+//
+// - invocation index i.e. `i` -th message's sequence number is last 32 -bits
+// of base nonce ( read as big endian ) + i, when `ctr` is nullptr
+// - compact per message counter array i.e. `i` -th message's sequence number
+// is `ctr[i]`, otherwise
+//
+// so that no nonce is materialized on host or transferred to device.
+//
+// Base nonce is read on host, during submission, while `ctr`, if given, must
+// be device accessible. Avoid nonce reuse i.e. ensure sequence numbers don't
+// repeat under same secret key ( in index mode, sequence number of base nonce
+// + `invk_cnt` must not exceed 2 ^ 32, which is asserted ) !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+encrypt_derived(
+  sycl::queue& q,                             // SYCL job submission queue
+  const uint8_t* const __restrict key,        // secret keys
+  const size_t key_len,                       // = invk_cnt * 16
+  const uint8_t* const __restrict base_nonce, // 16 -bytes base nonce, on host
+  const uint32_t* const __restrict ctr,       // sequence numbers or nullptr
+  const size_t ctr_len,                       // = invk_cnt * 4 or 0
+  const uint8_t* const __restrict text,       // plain text
+  const size_t text_len,                      // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,       // associated data
+  const size_t data_len,                      // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,              // encrypted data bytes
+  const size_t enc_len,                       // = text_len
+  uint8_t* const __restrict tag,              // authentication tags
+  const size_t tag_len,                       // = invk_cnt * 16
+  const size_t invk_cnt,                      // to be invoked these many times
+  const std::vector<sycl::event> evts         // SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert((ctr == nullptr ? 0 : invk_cnt << 2) == ctr_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(text_len == enc_len);
+  assert(ctr != nullptr || fits_sequence_space(base_nonce, invk_cnt));
+
+  const size_t per_invk_ct_len = text_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  nonce_base_t base;
+  for (size_t i = 0; i < 16; i++) {
+    base.bytes[i] = base_nonce[i];
+  }
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128EncryptDerived>([=
+    ]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        uint8_t nonce[16];
+        derive_nonce(base, sequence_number(base, ctr, i), nonce);
+
+        acorn::encrypt(key + knt_off,
+                       nonce,
+                       text + ct_off,
+                       per_invk_ct_len,
+                       data + add_off,
+                       per_invk_dt_len,
+                       enc + ct_off,
+                       tag + knt_off);
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see above ), but
+// nonce of each message is derived on device, from base nonce & invocation
+// index or per message counter array, same as `encrypt_derived` ( see above )
+// does
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+decrypt_derived(
+  sycl::queue& q,                             // SYCL job submission queue
+  const uint8_t* const __restrict key,        // secret keys
+  const size_t key_len,                       // = invk_cnt * 16
+  const uint8_t* const __restrict base_nonce, // 16 -bytes base nonce, on host
+  const uint32_t* const __restrict ctr,       // sequence numbers or nullptr
+  const size_t ctr_len,                       // = invk_cnt * 4 or 0
+  const uint8_t* const __restrict tag,        // authentication tags
+  const size_t tag_len,                       // = invk_cnt * 16
+  const uint8_t* const __restrict enc,        // encrypted data bytes
+  const size_t enc_len,                       // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,       // associated data
+  const size_t data_len,                      // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,             // plain text bytes
+  const size_t text_len,                      // = enc_len
+  bool* const __restrict flag,                // verification flags
+  const size_t flag_len,                      // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                      // to be invoked these many times
+  const std::vector<sycl::event> evts         // SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert((ctr == nullptr ? 0 : invk_cnt << 2) == ctr_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+  assert(ctr != nullptr || fits_sequence_space(base_nonce, invk_cnt));
+
+  const size_t per_invk_ct_len = enc_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  nonce_base_t base;
+  for (size_t i = 0; i < 16; i++) {
+    base.bytes[i] = base_nonce[i];
+  }
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128DecryptDerived>([=
+    ]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        uint8_t nonce[16];
+        derive_nonce(base, sequence_number(base, ctr, i), nonce);
+
+        const bool flg = acorn::decrypt(key + knt_off,
+                                        nonce,
+                                        tag + knt_off,
+                                        enc + ct_off,
+                                        per_invk_ct_len,
+                                        data + add_off,
+                                        per_invk_dt_len,
+                                        text + ct_off);
+
+        flag[i] = flg;
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see above ), but
+// instead of N -many boolean verification flags, it emits
+//
+// - N -bit verification mask, packed into ceil(N / 64) -many 64 -bit words,
+// where bit ( i & 63 ) of word ( i >> 6 ) is set iff `i` -th message passes
+// verification ( unused high bits of last word are zero )
+// - # -of messages which failed verification, in `fail_cnt[0]`
+// - indices of ( first `fail_cap` -many ) failed messages, in ascending order,
+// in `fail_idx`
+//
+// so that host can test `fail_cnt[0] == 0` alone, in common all-valid case,
+// while device -> host transfer of flags drops 8x. Failure count & failed
+// index list are reduced on device, while messages are being decrypted.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+decrypt_packed(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  uint64_t* const __restrict mask,       // bit-packed verification flags
+  const size_t mask_len,                 // = ceil(invk_cnt / 64) * 8
+  uint32_t* const __restrict fail_idx,   // indices of failed messages
+  const size_t fail_cap,                 // capacity of `fail_idx` in u32s
+  uint32_t* const __restrict fail_cnt,   // # -of failed messages, 1 u32
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(((invk_cnt + 63) >> 6) << 3 == mask_len);
+  assert(invk_cnt < (1ul << 32));
+
+  const size_t per_invk_ct_len = enc_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+  const size_t word_cnt = mask_len >> 3;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128DecryptPacked>([=
+    ]() [[intel::kernel_args_restrict]] {
+      uint32_t fails = 0;
+
+      for (size_t w = 0; w < word_cnt; w++) {
+        const size_t beg = w << 6;
+        const size_t end = beg + 64 < invk_cnt ? beg + 64 : invk_cnt;
+
+        uint64_t word = 0;
+
+        [[intel::ivdep]] for (size_t i = beg; i < end; i++)
+        {
+          const size_t knt_off = i << 4;
+          const size_t ct_off = i * per_invk_ct_len;
+          const size_t add_off = i * per_invk_dt_len;
+
+          const bool flg = acorn::decrypt(key + knt_off,
+                                          nonce + knt_off,
+                                          tag + knt_off,
+                                          enc + ct_off,
+                                          per_invk_ct_len,
+                                          data + add_off,
+                                          per_invk_dt_len,
+                                          text + ct_off);
+
+          word |= static_cast<uint64_t>(flg) << (i & 63);
+
+          if (!flg) {
+            if (fails < fail_cap) {
+              fail_idx[fails] = static_cast<uint32_t>(i);
+            }
+            fails++;
+          }
+        }
+
+        mask[w] = word;
+      }
+
+      fail_cnt[0] = fails;
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 authenticated encryption & verified decryption on FPGA, using a
+// single kernel, where direction is chosen either per message ( when `dir` is
+// non-null, `i` -th message is decrypted iff `dir[i]` is true ) or per batch (
+// when `dir` is null, all messages are decrypted iff `dec` is true )
+//
+// Both directions share one datapath ( see `acorn::crypt` ), so a bitstream
+// carrying this kernel, instead of separate encrypt & decrypt kernels, is
+// expected to spend its area on a single Acorn-128 pipeline, leaving room for
+// more replicated compute units ( see `acorn_fpga::crypt_replicated` ); not
+// yet measured on hardware.
+//
+// For `i` -th message
+//
+// - when encrypting, `in` holds plain text, `out` receives encrypted text,
+// computed authentication tag is written to `tag` & `flag[i]` is set
+// - when decrypting, `in` holds encrypted text, `out` receives decrypted text,
+// authentication tag is read from `tag` & `flag[i]` receives verification flag
+//
+// So after transferring output data back to host, verification flags need to
+// be tested for truth value, same as `decrypt` !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+crypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  uint8_t* const __restrict tag,         // authentication tags, out/ in
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict in,    // plain/ encrypted text bytes
+  const size_t in_len,                   // in_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict out,         // encrypted/ decrypted text bytes
+  const size_t out_len,                  // = in_len
+  const bool* const __restrict dir,      // per message direction, or null
+  const size_t dir_len,                  // invk_cnt * sizeof(bool), or 0
+  const bool dec,                        // batch direction, if `dir` is null
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(in_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(in_len == out_len);
+  assert(dir == nullptr || invk_cnt * sizeof(bool) == dir_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  const size_t per_invk_ct_len = in_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelAcorn128Crypt>([=]() [[intel::kernel_args_restrict]] {
+      [[intel::ivdep]] for (size_t i = 0; i < invk_cnt; i++)
+      {
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        const bool dec_ = dir == nullptr ? dec : dir[i];
+        const bool flg = acorn::crypt(key + knt_off,
+                                      nonce + knt_off,
+                                      tag + knt_off,
+                                      in + ct_off,
+                                      per_invk_ct_len,
+                                      data + add_off,
+                                      per_invk_dt_len,
+                                      out + ct_off,
+                                      dec_);
+
+        flag[i] = flg;
+      }
+    });
+  });
+  return evt;
+}
+
 }
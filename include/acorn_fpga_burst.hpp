@@ -0,0 +1,320 @@
+#pragma once
+#include "acorn_fpga.hpp"
+#include <cstdint>
+#include <numeric>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting FPGA using SYCL/ DPC++, where global memory
+// is only accessed in 512 -bit aligned lines, instead of byte/ 32 -bit word
+// granular accesses, issued by Acorn-128 routines, working on byte pointers
+//
+// Batch is walked in groups of G consecutive messages, where G is smallest
+// count such that text, associated data, keys, nonces & tags of a group, each
+// spans a whole number of 64 -bytes lines. Each group is loaded into on-chip
+// buffers, using wide loads ( which FPGA compiler is expected to turn into 512
+// -bit burst-coalesced LSUs; not yet confirmed by an FPGA optimization report
+// ), state machine is fed from there & results are written back, again using
+// wide stores.
+namespace acorn_fpga_burst {
+
+// To avoid kernel name mangling in FPGA optimization report
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128EncryptBurst;
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128DecryptBurst;
+
+// Width of a global memory access, in bytes ( = 512 -bit )
+constexpr size_t LINE_LEN = 64ul;
+
+// One 512 -bit line of global memory
+struct alignas(LINE_LEN) line_t
+{
+  uint8_t b[LINE_LEN];
+};
+
+// # -of consecutive messages, which form a group, so that each of text ( of
+// `ct_len` -bytes ), associated data ( of `d_len` -bytes ) & 16 -bytes key,
+// nonce, tag of a group, spans a whole number of lines
+template<const size_t ct_len, const size_t d_len>
+static constexpr size_t
+group_cnt()
+{
+  return LINE_LEN / std::gcd(std::gcd(ct_len, d_len), 16ul);
+}
+
+// Upper bound on byte length of a per group on-chip buffer ( i.e. group size x
+// text or associated data length ), so that lengths sharing no common factor
+// with 16 ( say 4095 -bytes text, asking for 64 -messages groups ) don't
+// silently eat hundreds of KiBs of on-chip memory
+constexpr size_t MAX_GROUP_BUF_LEN = 16384ul;
+
+// Whether per group on-chip buffers, for messages of `ct_len` -bytes text &
+// `d_len` -bytes associated data, fit within `MAX_GROUP_BUF_LEN`
+template<const size_t ct_len, const size_t d_len>
+static constexpr bool
+group_fits()
+{
+  constexpr size_t cnt = group_cnt<ct_len, d_len>();
+  return cnt * ct_len <= MAX_GROUP_BUF_LEN && cnt * d_len <= MAX_GROUP_BUF_LEN;
+}
+
+// Whether `ptr` is aligned to 512 -bit line boundary
+static inline bool
+is_aligned(const void* ptr)
+{
+  return (reinterpret_cast<uintptr_t>(ptr) & (LINE_LEN - 1)) == 0;
+}
+
+// Copies `len` -many bytes from line aligned global memory `src` to on-chip
+// buffer `dst`, using whole line loads, followed by bytewise copy of trailing
+// partial line ( if any, which only happens for last group of batch )
+static inline void
+load_lines(uint8_t* const __restrict dst,
+           const uint8_t* const __restrict src,
+           const size_t len)
+{
+  const size_t line_cnt = len / LINE_LEN;
+  const size_t tail_len = len % LINE_LEN;
+
+  const line_t* src_ = reinterpret_cast<const line_t*>(src);
+
+  for (size_t i = 0; i < line_cnt; i++) {
+    const line_t line = src_[i];
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+    for (size_t j = 0; j < LINE_LEN; j++) {
+      dst[i * LINE_LEN + j] = line.b[j];
+    }
+  }
+
+  for (size_t j = 0; j < tail_len; j++) {
+    dst[line_cnt * LINE_LEN + j] = src[line_cnt * LINE_LEN + j];
+  }
+}
+
+// Copies `len` -many bytes from on-chip buffer `src` to line aligned global
+// memory `dst`, using whole line stores, followed by bytewise copy of trailing
+// partial line ( if any, which only happens for last group of batch )
+static inline void
+store_lines(uint8_t* const __restrict dst,
+            const uint8_t* const __restrict src,
+            const size_t len)
+{
+  const size_t line_cnt = len / LINE_LEN;
+  const size_t tail_len = len % LINE_LEN;
+
+  line_t* dst_ = reinterpret_cast<line_t*>(dst);
+
+  for (size_t i = 0; i < line_cnt; i++) {
+    line_t line;
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+    for (size_t j = 0; j < LINE_LEN; j++) {
+      line.b[j] = src[i * LINE_LEN + j];
+    }
+
+    dst_[i] = line;
+  }
+
+  for (size_t j = 0; j < tail_len; j++) {
+    dst[line_cnt * LINE_LEN + j] = src[line_cnt * LINE_LEN + j];
+  }
+}
+
+}
+
+namespace acorn_fpga {
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt<ct_len, d_len>`
+// ( see include/acorn_fpga.hpp ), but global memory is read & written in 512
+// -bit lines, a group of messages at a time ( see `acorn_fpga_burst::`
+// namespace ), while Acorn-128 state machine works on on-chip buffers
+//
+// All global memory pointers must be 64 -bytes aligned, so allocate them using
+// `sycl::aligned_alloc_{device,host,shared}(64, ...)`. `invk_cnt` needn't be a
+// multiple of group size, while group size x per message text/ associated data
+// length must not exceed `MAX_GROUP_BUF_LEN` ( see `group_fits` ).
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline sycl::event
+encrypt_burst(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // = invk_cnt * per_invk_ct_len
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // = invk_cnt * per_invk_dt_len
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(invk_cnt * per_invk_ct_len == text_len);
+  assert(invk_cnt * per_invk_dt_len == data_len);
+  assert(text_len == enc_len);
+
+  using namespace acorn_fpga_burst;
+
+  assert(is_aligned(key) && is_aligned(nonce) && is_aligned(tag));
+  assert(is_aligned(text) && is_aligned(data) && is_aligned(enc));
+
+  constexpr size_t ct_len = per_invk_ct_len;
+  constexpr size_t d_len = per_invk_dt_len;
+  constexpr size_t grp = group_cnt<ct_len, d_len>();
+
+  static_assert(group_fits<ct_len, d_len>(),
+                "per group on-chip buffer exceeds MAX_GROUP_BUF_LEN");
+
+  using kernel_t = kernelAcorn128EncryptBurst<ct_len, d_len>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      for (size_t i = 0; i < invk_cnt; i += grp) {
+        // # -of messages in this group, fewer only for last one
+        const size_t cnt = invk_cnt - i < grp ? invk_cnt - i : grp;
+
+        [[intel::fpga_memory]] uint8_t key_[grp << 4];
+        [[intel::fpga_memory]] uint8_t nonce_[grp << 4];
+        [[intel::fpga_memory]] uint8_t tag_[grp << 4];
+
+        // + 1, so that zero-length array is never declared
+        [[intel::fpga_memory]] uint8_t data_[grp * d_len + 1];
+        [[intel::fpga_memory]] uint8_t text_[grp * ct_len + 1];
+        [[intel::fpga_memory]] uint8_t enc_[grp * ct_len + 1];
+
+        load_lines(key_, key + (i << 4), cnt << 4);
+        load_lines(nonce_, nonce + (i << 4), cnt << 4);
+        load_lines(data_, data + i * d_len, cnt * d_len);
+        load_lines(text_, text + i * ct_len, cnt * ct_len);
+
+        for (size_t j = 0; j < cnt; j++) {
+          const size_t knt_off = j << 4;
+          const size_t ct_off = j * ct_len;
+          const size_t add_off = j * d_len;
+
+          acorn::encrypt<ct_len, d_len>(key_ + knt_off,
+                                        nonce_ + knt_off,
+                                        text_ + ct_off,
+                                        data_ + add_off,
+                                        enc_ + ct_off,
+                                        tag_ + knt_off);
+        }
+
+        store_lines(enc + i * ct_len, enc_, cnt * ct_len);
+        store_lines(tag + (i << 4), tag_, cnt << 4);
+      }
+    });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt<ct_len, d_len>` (
+// see include/acorn_fpga.hpp ), but global memory is read & written in 512
+// -bit lines, same as `encrypt_burst` ( see above ); verification flags, being
+// a byte per message, are written as they're computed
+//
+// All global memory pointers, except `flag`, must be 64 -bytes aligned.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline sycl::event
+decrypt_burst(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // = invk_cnt * per_invk_ct_len
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // = invk_cnt * per_invk_dt_len
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(invk_cnt * per_invk_ct_len == enc_len);
+  assert(invk_cnt * per_invk_dt_len == data_len);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  using namespace acorn_fpga_burst;
+
+  assert(is_aligned(key) && is_aligned(nonce) && is_aligned(tag));
+  assert(is_aligned(enc) && is_aligned(data) && is_aligned(text));
+
+  constexpr size_t ct_len = per_invk_ct_len;
+  constexpr size_t d_len = per_invk_dt_len;
+  constexpr size_t grp = group_cnt<ct_len, d_len>();
+
+  static_assert(group_fits<ct_len, d_len>(),
+                "per group on-chip buffer exceeds MAX_GROUP_BUF_LEN");
+
+  using kernel_t = kernelAcorn128DecryptBurst<ct_len, d_len>;
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernel_t>([=]() [[intel::kernel_args_restrict]] {
+      for (size_t i = 0; i < invk_cnt; i += grp) {
+        // # -of messages in this group, fewer only for last one
+        const size_t cnt = invk_cnt - i < grp ? invk_cnt - i : grp;
+
+        [[intel::fpga_memory]] uint8_t key_[grp << 4];
+        [[intel::fpga_memory]] uint8_t nonce_[grp << 4];
+        [[intel::fpga_memory]] uint8_t tag_[grp << 4];
+
+        // + 1, so that zero-length array is never declared
+        [[intel::fpga_memory]] uint8_t data_[grp * d_len + 1];
+        [[intel::fpga_memory]] uint8_t enc_[grp * ct_len + 1];
+        [[intel::fpga_memory]] uint8_t text_[grp * ct_len + 1];
+
+        load_lines(key_, key + (i << 4), cnt << 4);
+        load_lines(nonce_, nonce + (i << 4), cnt << 4);
+        load_lines(tag_, tag + (i << 4), cnt << 4);
+        load_lines(data_, data + i * d_len, cnt * d_len);
+        load_lines(enc_, enc + i * ct_len, cnt * ct_len);
+
+        for (size_t j = 0; j < cnt; j++) {
+          const size_t knt_off = j << 4;
+          const size_t ct_off = j * ct_len;
+          const size_t add_off = j * d_len;
+
+          flag[i + j] = acorn::decrypt<ct_len, d_len>(key_ + knt_off,
+                                                      nonce_ + knt_off,
+                                                      tag_ + knt_off,
+                                                      enc_ + ct_off,
+                                                      data_ + add_off,
+                                                      text_ + ct_off);
+        }
+
+        store_lines(text + i * ct_len, text_, cnt * ct_len);
+      }
+    });
+  });
+  return evt;
+}
+
+}
@@ -0,0 +1,462 @@
+#pragma once
+#include "acorn_fpga.hpp"
+#include <utility>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting FPGA using SYCL/ DPC++, where K -many
+// independent compute units ( i.e. copies of single work-item kernel, each
+// with its own kernel name, so that FPGA compiler synthesizes K pipelines ) are
+// instantiated, each owning a contiguous slice of batch
+//
+// Each Acorn-128 message is a strictly serial chain of state updates, so a
+// single pipeline is bounded by how fast it can advance one state, while spare
+// FPGA area can host more of them.
+namespace acorn_fpga_cu {
+
+// To avoid kernel name mangling in FPGA optimization report, each compute unit
+// gets its own kernel name, keyed on both # -of compute units & unit index, so
+// that replicating same kernel with different `cu_cnt` doesn't reuse a name
+template<const size_t cu_cnt, const size_t cu>
+class kernelAcorn128EncryptCU;
+template<const size_t cu_cnt, const size_t cu>
+class kernelAcorn128DecryptCU;
+template<const size_t cu_cnt, const size_t cu>
+class kernelAcorn128CryptCU;
+
+// Maximum # -of compute units, that can be requested
+constexpr size_t MAX_CU_CNT = 16ul;
+
+// Returns [beg, end) message index range, owned by `cu` -th compute unit, when
+// `invk_cnt` -many messages are split ( as evenly as possible ) among `cu_cnt`
+// -many compute units
+static inline std::pair<size_t, size_t>
+slice(const size_t invk_cnt, const size_t cu_cnt, const size_t cu)
+{
+  const size_t beg = (cu * invk_cnt) / cu_cnt;
+  const size_t end = ((cu + 1) * invk_cnt) / cu_cnt;
+
+  return { beg, end };
+}
+
+// Submits encrypt kernels of compute units [cu, cu_cnt), each working on its
+// own slice of batch, while pushing their events into `units`
+template<const size_t cu_cnt, const size_t cu = 0>
+static inline void
+submit_encrypt(sycl::queue& q,
+               const uint8_t* const __restrict key,
+               const uint8_t* const __restrict nonce,
+               const uint8_t* const __restrict text,
+               const uint8_t* const __restrict data,
+               uint8_t* const __restrict enc,
+               uint8_t* const __restrict tag,
+               const size_t per_invk_ct_len,
+               const size_t per_invk_dt_len,
+               const size_t invk_cnt,
+               const std::vector<sycl::event>& evts,
+               std::vector<sycl::event>& units)
+{
+  if constexpr (cu < cu_cnt) {
+    const auto [beg, end] = slice(invk_cnt, cu_cnt, cu);
+    const size_t cnt = end - beg;
+
+    if (cnt > 0) {
+      const uint8_t* key_ = key + (beg << 4);
+      const uint8_t* nonce_ = nonce + (beg << 4);
+      const uint8_t* text_ = text + beg * per_invk_ct_len;
+      const uint8_t* data_ = data + beg * per_invk_dt_len;
+      uint8_t* enc_ = enc + beg * per_invk_ct_len;
+      uint8_t* tag_ = tag + (beg << 4);
+
+      units.push_back(q.submit([&](sycl::handler& h) {
+        h.depends_on(evts);
+        h.single_task<kernelAcorn128EncryptCU<cu_cnt, cu>>([=
+        ]() [[intel::kernel_args_restrict]] {
+          [[intel::ivdep]] for (size_t i = 0; i < cnt; i++)
+          {
+            const size_t knt_off = i << 4;
+            const size_t ct_off = i * per_invk_ct_len;
+            const size_t add_off = i * per_invk_dt_len;
+
+            acorn::encrypt(key_ + knt_off,
+                           nonce_ + knt_off,
+                           text_ + ct_off,
+                           per_invk_ct_len,
+                           data_ + add_off,
+                           per_invk_dt_len,
+                           enc_ + ct_off,
+                           tag_ + knt_off);
+          }
+        });
+      }));
+    }
+
+    submit_encrypt<cu_cnt, cu + 1>(q,
+                                   key,
+                                   nonce,
+                                   text,
+                                   data,
+                                   enc,
+                                   tag,
+                                   per_invk_ct_len,
+                                   per_invk_dt_len,
+                                   invk_cnt,
+                                   evts,
+                                   units);
+  }
+}
+
+// Submits decrypt kernels of compute units [cu, cu_cnt), each working on its
+// own slice of batch, while pushing their events into `units`
+template<const size_t cu_cnt, const size_t cu = 0>
+static inline void
+submit_decrypt(sycl::queue& q,
+               const uint8_t* const __restrict key,
+               const uint8_t* const __restrict nonce,
+               const uint8_t* const __restrict tag,
+               const uint8_t* const __restrict enc,
+               const uint8_t* const __restrict data,
+               uint8_t* const __restrict text,
+               bool* const __restrict flag,
+               const size_t per_invk_ct_len,
+               const size_t per_invk_dt_len,
+               const size_t invk_cnt,
+               const std::vector<sycl::event>& evts,
+               std::vector<sycl::event>& units)
+{
+  if constexpr (cu < cu_cnt) {
+    const auto [beg, end] = slice(invk_cnt, cu_cnt, cu);
+    const size_t cnt = end - beg;
+
+    if (cnt > 0) {
+      const uint8_t* key_ = key + (beg << 4);
+      const uint8_t* nonce_ = nonce + (beg << 4);
+      const uint8_t* tag_ = tag + (beg << 4);
+      const uint8_t* enc_ = enc + beg * per_invk_ct_len;
+      const uint8_t* data_ = data + beg * per_invk_dt_len;
+      uint8_t* text_ = text + beg * per_invk_ct_len;
+      bool* flag_ = flag + beg;
+
+      units.push_back(q.submit([&](sycl::handler& h) {
+        h.depends_on(evts);
+        h.single_task<kernelAcorn128DecryptCU<cu_cnt, cu>>([=
+        ]() [[intel::kernel_args_restrict]] {
+          [[intel::ivdep]] for (size_t i = 0; i < cnt; i++)
+          {
+            const size_t knt_off = i << 4;
+            const size_t ct_off = i * per_invk_ct_len;
+            const size_t add_off = i * per_invk_dt_len;
+
+            const bool flg = acorn::decrypt(key_ + knt_off,
+                                            nonce_ + knt_off,
+                                            tag_ + knt_off,
+                                            enc_ + ct_off,
+                                            per_invk_ct_len,
+                                            data_ + add_off,
+                                            per_invk_dt_len,
+                                            text_ + ct_off);
+
+            flag_[i] = flg;
+          }
+        });
+      }));
+    }
+
+    submit_decrypt<cu_cnt, cu + 1>(q,
+                                   key,
+                                   nonce,
+                                   tag,
+                                   enc,
+                                   data,
+                                   text,
+                                   flag,
+                                   per_invk_ct_len,
+                                   per_invk_dt_len,
+                                   invk_cnt,
+                                   evts,
+                                   units);
+  }
+}
+
+// Submits unified encrypt/ decrypt kernels ( see `acorn_fpga::crypt` ) of
+// compute units [cu, cu_cnt), each working on its own slice of batch, while
+// pushing their events into `units`
+template<const size_t cu_cnt, const size_t cu = 0>
+static inline void
+submit_crypt(sycl::queue& q,
+             const uint8_t* const __restrict key,
+             const uint8_t* const __restrict nonce,
+             uint8_t* const __restrict tag,
+             const uint8_t* const __restrict in,
+             const uint8_t* const __restrict data,
+             uint8_t* const __restrict out,
+             const bool* const __restrict dir,
+             const bool dec,
+             bool* const __restrict flag,
+             const size_t per_invk_ct_len,
+             const size_t per_invk_dt_len,
+             const size_t invk_cnt,
+             const std::vector<sycl::event>& evts,
+             std::vector<sycl::event>& units)
+{
+  if constexpr (cu < cu_cnt) {
+    const auto [beg, end] = slice(invk_cnt, cu_cnt, cu);
+    const size_t cnt = end - beg;
+
+    if (cnt > 0) {
+      const uint8_t* key_ = key + (beg << 4);
+      const uint8_t* nonce_ = nonce + (beg << 4);
+      uint8_t* tag_ = tag + (beg << 4);
+      const uint8_t* in_ = in + beg * per_invk_ct_len;
+      const uint8_t* data_ = data + beg * per_invk_dt_len;
+      uint8_t* out_ = out + beg * per_invk_ct_len;
+      const bool* dir_ = dir == nullptr ? nullptr : dir + beg;
+      bool* flag_ = flag + beg;
+
+      units.push_back(q.submit([&](sycl::handler& h) {
+        h.depends_on(evts);
+        h.single_task<kernelAcorn128CryptCU<cu_cnt, cu>>([=
+        ]() [[intel::kernel_args_restrict]] {
+          [[intel::ivdep]] for (size_t i = 0; i < cnt; i++)
+          {
+            const size_t knt_off = i << 4;
+            const size_t ct_off = i * per_invk_ct_len;
+            const size_t add_off = i * per_invk_dt_len;
+
+            const bool dec_ = dir_ == nullptr ? dec : dir_[i];
+            const bool flg = acorn::crypt(key_ + knt_off,
+                                          nonce_ + knt_off,
+                                          tag_ + knt_off,
+                                          in_ + ct_off,
+                                          per_invk_ct_len,
+                                          data_ + add_off,
+                                          per_invk_dt_len,
+                                          out_ + ct_off,
+                                          dec_);
+
+            flag_[i] = flg;
+          }
+        });
+      }));
+    }
+
+    submit_crypt<cu_cnt, cu + 1>(q,
+                                 key,
+                                 nonce,
+                                 tag,
+                                 in,
+                                 data,
+                                 out,
+                                 dir,
+                                 dec,
+                                 flag,
+                                 per_invk_ct_len,
+                                 per_invk_dt_len,
+                                 invk_cnt,
+                                 evts,
+                                 units);
+  }
+}
+
+}
+
+namespace acorn_fpga {
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt` ( see
+// include/acorn_fpga.hpp ), but batch of N -many messages is split among
+// `cu_cnt` -many compute units ( see `acorn_fpga_cu::` namespace ), each
+// owning a contiguous slice of ~ N / `cu_cnt` messages, running concurrently
+//
+// Returns one SYCL event per compute unit, which was handed a non-empty slice;
+// these can be passed as dependencies of following SYCL commands.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t cu_cnt>
+static inline std::vector<sycl::event>
+encrypt_replicated(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  static_assert(cu_cnt > 0 && cu_cnt <= acorn_fpga_cu::MAX_CU_CNT,
+                "# -of compute units must be in [1, MAX_CU_CNT]");
+
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(text_len == enc_len);
+
+  const size_t per_invk_ct_len = text_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  std::vector<sycl::event> units;
+  units.reserve(cu_cnt);
+
+  acorn_fpga_cu::submit_encrypt<cu_cnt>(q,
+                                        key,
+                                        nonce,
+                                        text,
+                                        data,
+                                        enc,
+                                        tag,
+                                        per_invk_ct_len,
+                                        per_invk_dt_len,
+                                        invk_cnt,
+                                        evts,
+                                        units);
+  return units;
+}
+
+// Acorn-128 verified decryption on FPGA, same as `decrypt` ( see
+// include/acorn_fpga.hpp ), but batch of N -many messages is split among
+// `cu_cnt` -many compute units, same as `encrypt_replicated` ( see above )
+//
+// Returns one SYCL event per compute unit, which was handed a non-empty slice.
+// After transferring output data back to host, first verification flags need
+// to be tested for truth value !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t cu_cnt>
+static inline std::vector<sycl::event>
+decrypt_replicated(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  static_assert(cu_cnt > 0 && cu_cnt <= acorn_fpga_cu::MAX_CU_CNT,
+                "# -of compute units must be in [1, MAX_CU_CNT]");
+
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  const size_t per_invk_ct_len = enc_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  std::vector<sycl::event> units;
+  units.reserve(cu_cnt);
+
+  acorn_fpga_cu::submit_decrypt<cu_cnt>(q,
+                                        key,
+                                        nonce,
+                                        tag,
+                                        enc,
+                                        data,
+                                        text,
+                                        flag,
+                                        per_invk_ct_len,
+                                        per_invk_dt_len,
+                                        invk_cnt,
+                                        evts,
+                                        units);
+  return units;
+}
+
+// Acorn-128 authenticated encryption & verified decryption on FPGA, same as
+// `crypt` ( see include/acorn_fpga.hpp ), but batch of N -many messages is
+// split among `cu_cnt` -many compute units, same as `encrypt_replicated` ( see
+// above ), each running unified encrypt/ decrypt kernel
+//
+// Each compute unit carries one shared datapath, instead of separate encrypt &
+// decrypt ones; area impact isn't yet measured on hardware.
+//
+// Returns one SYCL event per compute unit, which was handed a non-empty slice.
+// After transferring output data back to host, first verification flags need
+// to be tested for truth value !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t cu_cnt>
+static inline std::vector<sycl::event>
+crypt_replicated(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  uint8_t* const __restrict tag,         // authentication tags, out/ in
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict in,    // plain/ encrypted text bytes
+  const size_t in_len,                   // in_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict out,         // encrypted/ decrypted text bytes
+  const size_t out_len,                  // = in_len
+  const bool* const __restrict dir,      // per message direction, or null
+  const size_t dir_len,                  // invk_cnt * sizeof(bool), or 0
+  const bool dec,                        // batch direction, if `dir` is null
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  static_assert(cu_cnt > 0 && cu_cnt <= acorn_fpga_cu::MAX_CU_CNT,
+                "# -of compute units must be in [1, MAX_CU_CNT]");
+
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(in_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(in_len == out_len);
+  assert(dir == nullptr || invk_cnt * sizeof(bool) == dir_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  const size_t per_invk_ct_len = in_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  std::vector<sycl::event> units;
+  units.reserve(cu_cnt);
+
+  acorn_fpga_cu::submit_crypt<cu_cnt>(q,
+                                      key,
+                                      nonce,
+                                      tag,
+                                      in,
+                                      data,
+                                      out,
+                                      dir,
+                                      dec,
+                                      flag,
+                                      per_invk_ct_len,
+                                      per_invk_dt_len,
+                                      invk_cnt,
+                                      evts,
+                                      units);
+  return units;
+}
+
+}
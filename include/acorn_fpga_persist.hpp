@@ -0,0 +1,294 @@
+#pragma once
+#include "acorn_fpga.hpp"
+#include <bit>
+#include <thread>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting FPGA using SYCL/ DPC++, where a single,
+// long-running kernel keeps polling a ring of message slots, living in USM
+// host memory, & encrypts/ decrypts each message as soon as host publishes it,
+// until it's told to stop
+//
+// So there's no kernel launch per batch; once kernel is running, host pays only
+// for writing a message slot & observing its completion, which gives per
+// message latency, instead of per batch latency.
+namespace acorn_fpga_persist {
+
+// To avoid kernel name mangling in FPGA optimization report
+class kernelAcorn128Persistent;
+
+// What to do with message, living in a ring slot
+enum class op_t : uint32_t
+{
+  encrypt = 0u, // authenticated encryption, computes tag
+  decrypt = 1u  // verified decryption, consumes tag
+};
+
+// Per slot message descriptor, written by host, before publishing slot
+struct desc_t
+{
+  op_t op;         // what to do with this slot ?
+  uint32_t ct_len; // plain/ cipher text byte length
+  uint32_t d_len;  // associated data byte length
+};
+
+// Atomic view of a 64 -bit counter, shared by host & device, so it's scoped to
+// whole system
+using counter_t = sycl::atomic_ref<uint64_t,
+                                   sycl::memory_order::relaxed,
+                                   sycl::memory_scope::system,
+                                   sycl::access::address_space::global_space>;
+
+// Ring of `slot_cnt` -many message slots ( in USM host memory ), each of which
+// can hold a message of at most `max_ct_len` -bytes text & `max_d_len` -bytes
+// associated data, along with persistent kernel consuming them
+//
+// Host publishes n -th message in slot ( n % `slot_cnt` ) & bumps `head`, while
+// kernel bumps `tail`, after it's done with n -th message. Results are
+// collected in order, using `pop`, which frees up oldest slot. A slot is never
+// republished before its results are collected, so host & kernel never touch
+// same slot at same time. Kernel exits once `quit` is raised & it has caught up
+// with `head`.
+//
+// Note, `push` & `pop` are supposed to be called from a single host thread.
+class ring_t
+{
+public:
+  ring_t(sycl::queue& q_,
+         const size_t slot_cnt_,
+         const size_t max_ct_len_,
+         const size_t max_d_len_)
+    : q(q_)
+    , slot_cnt(slot_cnt_)
+    , max_ct_len(max_ct_len_)
+    , max_d_len(max_d_len_)
+    , pushed(0)
+    , popped(0)
+    , running(false)
+  {
+    assert(std::has_single_bit(slot_cnt));
+    assert(max_ct_len <= UINT32_MAX && max_d_len <= UINT32_MAX);
+
+    ctrl = sycl::malloc_host<uint64_t>(3, q);
+    descs = sycl::malloc_host<desc_t>(slot_cnt, q);
+    keys = sycl::malloc_host<uint8_t>(slot_cnt << 4, q);
+    nonces = sycl::malloc_host<uint8_t>(slot_cnt << 4, q);
+    tags = sycl::malloc_host<uint8_t>(slot_cnt << 4, q);
+    ins = sycl::malloc_host<uint8_t>(slot_cnt * max_ct_len, q);
+    datas = sycl::malloc_host<uint8_t>(slot_cnt * max_d_len, q);
+    outs = sycl::malloc_host<uint8_t>(slot_cnt * max_ct_len, q);
+    flags = sycl::malloc_host<bool>(slot_cnt, q);
+  }
+
+  ring_t(const ring_t&) = delete;
+  ring_t& operator=(const ring_t&) = delete;
+
+  ~ring_t()
+  {
+    // kernel must not be polling freed memory, so if it's still running, tell
+    // it to drain published messages & exit, before freeing ring
+    if (running) {
+      stop();
+    }
+
+    sycl::free(ctrl, q);
+    sycl::free(descs, q);
+    sycl::free(keys, q);
+    sycl::free(nonces, q);
+    sycl::free(tags, q);
+    sycl::free(ins, q);
+    sycl::free(datas, q);
+    sycl::free(outs, q);
+    sycl::free(flags, q);
+  }
+
+  // Launches persistent kernel, which keeps consuming published slots until
+  // it's told to stop; returned event completes only after `stop`
+  //
+  // Ring can be restarted after `stop`, once all results are collected.
+  sycl::event start()
+  {
+    assert(!running);
+    assert(in_flight() == 0);
+
+    pushed = 0;
+    popped = 0;
+    ctrl[0] = 0; // head
+    ctrl[1] = 0; // tail
+    ctrl[2] = 0; // quit
+
+    uint64_t* ctrl_ = ctrl;
+    const desc_t* descs_ = descs;
+    const uint8_t* keys_ = keys;
+    const uint8_t* nonces_ = nonces;
+    uint8_t* tags_ = tags;
+    const uint8_t* ins_ = ins;
+    const uint8_t* datas_ = datas;
+    uint8_t* outs_ = outs;
+    bool* flags_ = flags;
+
+    const size_t mask = slot_cnt - 1;
+    const size_t ct_cap = max_ct_len;
+    const size_t d_cap = max_d_len;
+
+    evt = q.submit([&](sycl::handler& h) {
+      h.single_task<kernelAcorn128Persistent>([=]() {
+        counter_t head{ ctrl_[0] };
+        counter_t tail{ ctrl_[1] };
+        counter_t quit{ ctrl_[2] };
+
+        uint64_t seq = 0;
+        while (true) {
+          // `quit` is read before `head`, so that all slots published before
+          // raising it are seen
+          const bool done = quit.load(sycl::memory_order::acquire) != 0;
+
+          // spin until host publishes next slot
+          if (head.load(sycl::memory_order::acquire) == seq) {
+            if (done) {
+              break;
+            }
+            continue;
+          }
+
+          const size_t s = static_cast<size_t>(seq) & mask;
+          const desc_t desc = descs_[s];
+
+          const size_t knt_off = s << 4;
+          const size_t ct_off = s * ct_cap;
+          const size_t add_off = s * d_cap;
+
+          flags_[s] = acorn::crypt(keys_ + knt_off,
+                                   nonces_ + knt_off,
+                                   tags_ + knt_off,
+                                   ins_ + ct_off,
+                                   desc.ct_len,
+                                   datas_ + add_off,
+                                   desc.d_len,
+                                   outs_ + ct_off,
+                                   desc.op == op_t::decrypt);
+
+          // publish results of this slot
+          seq++;
+          tail.store(seq, sycl::memory_order::release);
+        }
+      });
+    });
+
+    running = true;
+    return evt;
+  }
+
+  // Copies a message into next free slot & publishes it to kernel; returns
+  // false ( without publishing anything ) when all slots are occupied, in which
+  // case results of oldest message need to be collected, using `pop`, first
+  //
+  // When encrypting, `tag` isn't read ( can be null ), while when decrypting,
+  // it must hold 128 -bit authentication tag.
+  bool push(const uint8_t* const __restrict key,   // 128 -bit secret key
+            const uint8_t* const __restrict nonce, // 128 -bit message nonce
+            const uint8_t* const __restrict tag,   // 128 -bit auth tag, if dec
+            const uint8_t* const __restrict in,    // plain/ encrypted bytes
+            const size_t ct_len,                   // len(in) <= max_ct_len
+            const uint8_t* const __restrict data,  // associated data bytes
+            const size_t d_len,                    // len(data) <= max_d_len
+            const bool dec                         // decrypting `in` ?
+  )
+  {
+    assert(running);
+    assert(ct_len <= max_ct_len);
+    assert(d_len <= max_d_len);
+
+    if (pushed - popped == slot_cnt) {
+      return false;
+    }
+
+    const size_t s = static_cast<size_t>(pushed) & (slot_cnt - 1);
+    const size_t knt_off = s << 4;
+
+    std::memcpy(keys + knt_off, key, 16);
+    std::memcpy(nonces + knt_off, nonce, 16);
+    if (dec) {
+      std::memcpy(tags + knt_off, tag, 16);
+    }
+    std::memcpy(ins + s * max_ct_len, in, ct_len);
+    std::memcpy(datas + s * max_d_len, data, d_len);
+
+    descs[s] = { dec ? op_t::decrypt : op_t::encrypt,
+                 static_cast<uint32_t>(ct_len),
+                 static_cast<uint32_t>(d_len) };
+
+    pushed++;
+    counter_t{ ctrl[0] }.store(pushed, sycl::memory_order::release);
+    return true;
+  }
+
+  // Blocks until oldest in-flight message is processed by kernel, copies its
+  // encrypted/ decrypted bytes to `out` &, if it was encrypted, computed tag to
+  // `tag`, then frees up its slot; returns verification flag ( always true for
+  // encrypted messages ), which must be tested before consuming decrypted bytes
+  bool pop(uint8_t* const __restrict out, // encrypted/ decrypted bytes
+           uint8_t* const __restrict tag  // 128 -bit auth tag, if encrypted
+  )
+  {
+    assert(popped < pushed);
+
+    counter_t tail{ ctrl[1] };
+    while (tail.load(sycl::memory_order::acquire) == popped) {
+      std::this_thread::yield();
+    }
+
+    const size_t s = static_cast<size_t>(popped) & (slot_cnt - 1);
+    const desc_t desc = descs[s];
+
+    std::memcpy(out, outs + s * max_ct_len, desc.ct_len);
+    if (desc.op == op_t::encrypt) {
+      std::memcpy(tag, tags + (s << 4), 16);
+    }
+    const bool flg = flags[s];
+
+    popped++;
+    return flg;
+  }
+
+  // Tells kernel to exit, after it's done with all published messages, &
+  // waits for it
+  //
+  // Results of messages published before `stop` can still be collected, using
+  // `pop`, afterwards.
+  void stop()
+  {
+    assert(running);
+
+    counter_t{ ctrl[2] }.store(1, sycl::memory_order::release);
+
+    evt.wait();
+    running = false;
+  }
+
+  // # -of published messages, whose results are yet to be collected
+  size_t in_flight() const { return static_cast<size_t>(pushed - popped); }
+
+private:
+  sycl::queue& q;
+  const size_t slot_cnt;   // power of 2
+  const size_t max_ct_len; // per slot text capacity, in bytes
+  const size_t max_d_len;  // per slot associated data capacity, in bytes
+
+  uint64_t* ctrl;  // [head, tail, quit], shared with kernel
+  desc_t* descs;   // per slot message descriptors
+  uint8_t* keys;   // per slot secret keys
+  uint8_t* nonces; // per slot message nonces
+  uint8_t* tags;   // per slot authentication tags
+  uint8_t* ins;    // per slot plain/ encrypted bytes
+  uint8_t* datas;  // per slot associated data bytes
+  uint8_t* outs;   // per slot encrypted/ decrypted bytes
+  bool* flags;     // per slot verification flags
+
+  uint64_t pushed; // # -of published slots
+  uint64_t popped; // # -of collected slots
+  bool running;    // is kernel polling ring ?
+  sycl::event evt; // completes when kernel exits
+};
+
+}
@@ -0,0 +1,354 @@
+#pragma once
+#include "acorn_fpga.hpp"
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting FPGA using SYCL/ DPC++, where global memory
+// accesses are decoupled from Acorn state machine, by splitting work among
+// three kernels, connected using SYCL pipes
+//
+// - reader kernel, bursting secret key, nonce, associated data & plain text
+// from global memory into input pipe, as 128 -bit chunks
+// - compute kernel, consuming input pipe one 32 -bit word at a time, running
+// Acorn-128 state update as each word arrives & producing encrypted text &
+// authentication tag into output pipe
+// - writer kernel, draining output pipe into global memory, as 128 -bit chunks
+//
+// which is expected to keep memory stalls of reader/ writer from throttling
+// compute pipeline; that's not yet confirmed by an FPGA optimization report or
+// h/w run, see single vs. piped kernel table of `make fpga_emu_bench`/ `make
+// fpga_hw_bench`.
+namespace acorn_fpga_pipe {
+
+// To avoid kernel name mangling in FPGA optimization report
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128Reader;
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128EncryptCompute;
+template<const size_t ct_len, const size_t d_len>
+class kernelAcorn128Writer;
+
+// Pipe identifiers, so that each specialization gets its own pair of pipes
+template<const size_t ct_len, const size_t d_len>
+class InPipeId;
+template<const size_t ct_len, const size_t d_len>
+class OutPipeId;
+
+// Minimum capacity of each pipe, in terms of 128 -bit chunks
+constexpr int PIPE_DEPTH = 64;
+
+// 128 -bit pipe payload, holding four big endian 32 -bit words ( i.e. 16
+// consecutive bytes of a message field ), so that reader/ writer kernels move
+// 16 -bytes per global memory access & per pipe transaction
+struct chunk_t
+{
+  uint32_t w[4];
+};
+
+// Reader -> compute pipe, carrying ( per message ) secret key, nonce,
+// associated data & plain text, in order, as 128 -bit chunks; each field starts
+// at a chunk boundary & its last chunk is zero padded
+template<const size_t ct_len, const size_t d_len>
+using in_pipe =
+  sycl::ext::intel::pipe<InPipeId<ct_len, d_len>, chunk_t, PIPE_DEPTH>;
+
+// Compute -> writer pipe, carrying ( per message ) encrypted text &
+// authentication tag, in order, as 128 -bit chunks, laid out same as above
+template<const size_t ct_len, const size_t d_len>
+using out_pipe =
+  sycl::ext::intel::pipe<OutPipeId<ct_len, d_len>, chunk_t, PIPE_DEPTH>;
+
+// Loads `len` -many bytes ( <= 16 ) into a 128 -bit chunk, where missing
+// trailing bytes are zero padded; for `len` = 16, fully unrolled byte loop is
+// a single 128 -bit load, as far as FPGA compiler is concerned
+template<const size_t len>
+static inline chunk_t
+load_chunk(const uint8_t* const __restrict bytes)
+{
+  uint8_t b[16] = {};
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+  for (size_t i = 0; i < len; i++) {
+    b[i] = bytes[i];
+  }
+
+  chunk_t c;
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+  for (size_t i = 0; i < 4; i++) {
+    c.w[i] = acorn_utils::from_be_bytes(b + (i << 2));
+  }
+  return c;
+}
+
+// Stores first `len` -many bytes ( <= 16 ) of a 128 -bit chunk, see above
+template<const size_t len>
+static inline void
+store_chunk(const chunk_t& c, uint8_t* const __restrict bytes)
+{
+  uint8_t b[16];
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+  for (size_t i = 0; i < 4; i++) {
+    acorn_utils::to_be_bytes(c.w[i], b + (i << 2));
+  }
+
+#if defined(__clang__)
+#pragma unroll
+#endif
+  for (size_t i = 0; i < len; i++) {
+    bytes[i] = b[i];
+  }
+}
+
+// Writes `len` -many bytes into pipe `P`, as ceil(len / 16) -many 128 -bit
+// chunks, where last one is zero padded
+template<typename P, const size_t len>
+static inline void
+write_chunks(const uint8_t* const __restrict bytes)
+{
+  constexpr size_t full_cnt = len >> 4;
+  constexpr size_t tail_len = len & 15ul;
+
+  for (size_t i = 0; i < full_cnt; i++) {
+    P::write(load_chunk<16>(bytes + (i << 4)));
+  }
+
+  if constexpr (tail_len > 0) {
+    P::write(load_chunk<tail_len>(bytes + (full_cnt << 4)));
+  }
+}
+
+// Reads `len` -many bytes from pipe `P`, which were written as 128 -bit chunks
+template<typename P, const size_t len>
+static inline void
+read_chunks(uint8_t* const __restrict bytes)
+{
+  constexpr size_t full_cnt = len >> 4;
+  constexpr size_t tail_len = len & 15ul;
+
+  for (size_t i = 0; i < full_cnt; i++) {
+    store_chunk<16>(P::read(), bytes + (i << 4));
+  }
+
+  if constexpr (tail_len > 0) {
+    store_chunk<tail_len>(P::read(), bytes + (full_cnt << 4));
+  }
+}
+
+// Hands out 32 -bit words of a message field, in order, reading next 128 -bit
+// chunk from pipe `P` only after all four words of current one are consumed
+template<typename P>
+struct word_reader_t
+{
+  chunk_t c;
+  size_t idx = 4;
+
+  uint32_t next()
+  {
+    if (idx == 4) {
+      c = P::read();
+      idx = 0;
+    }
+    return c.w[idx++];
+  }
+};
+
+// Collects 32 -bit words of a message field, in order, writing a 128 -bit chunk
+// into pipe `P` as soon as it's full; `flush` writes last, partially filled (
+// zero padded ) chunk, if any
+template<typename P>
+struct word_writer_t
+{
+  chunk_t c = {};
+  size_t idx = 0;
+
+  void put(const uint32_t word)
+  {
+    c.w[idx++] = word;
+    if (idx == 4) {
+      P::write(c);
+      c = {};
+      idx = 0;
+    }
+  }
+
+  void flush()
+  {
+    if (idx > 0) {
+      P::write(c);
+      c = {};
+      idx = 0;
+    }
+  }
+};
+
+}
+
+namespace acorn_fpga {
+
+// Acorn-128 authenticated encryption on FPGA, same as `encrypt<ct_len, d_len>`
+// ( see include/acorn_fpga.hpp ), but instead of a single kernel, doing global
+// memory loads, Acorn-128 state updates & global memory stores in same loop,
+// it submits reader, compute & writer kernels, connected using SYCL pipes (
+// see `acorn_fpga_pipe::` namespace ), which run concurrently on device
+//
+// Per message byte lengths of plain text & associated data are compile-time
+// constants, so that loop bounds of all three kernels are static; compute
+// kernel never buffers a whole message, it only keeps 293 -bit Acorn state.
+//
+// Returned event denotes completion of writer kernel, after which encrypted
+// text & authentication tags are available in global memory.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline sycl::event
+encrypt_piped(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // = invk_cnt * per_invk_ct_len
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // = invk_cnt * per_invk_dt_len
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // to be invoked these many times
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(invk_cnt * per_invk_ct_len == text_len);
+  assert(invk_cnt * per_invk_dt_len == data_len);
+  assert(text_len == enc_len);
+
+  using namespace acorn_fpga_pipe;
+
+  constexpr size_t ct_len = per_invk_ct_len;
+  constexpr size_t d_len = per_invk_dt_len;
+
+  using ipipe = in_pipe<ct_len, d_len>;
+  using opipe = out_pipe<ct_len, d_len>;
+
+  using reader_t = kernelAcorn128Reader<ct_len, d_len>;
+  using compute_t = kernelAcorn128EncryptCompute<ct_len, d_len>;
+  using writer_t = kernelAcorn128Writer<ct_len, d_len>;
+
+  // global memory -> input pipe
+  q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<reader_t>([=]() [[intel::kernel_args_restrict]] {
+      for (size_t i = 0; i < invk_cnt; i++) {
+        const size_t knt_off = i << 4;
+
+        write_chunks<ipipe, 16>(key + knt_off);
+        write_chunks<ipipe, 16>(nonce + knt_off);
+        write_chunks<ipipe, d_len>(data + i * d_len);
+        write_chunks<ipipe, ct_len>(text + i * ct_len);
+      }
+    });
+  });
+
+  // input pipe -> Acorn-128 -> output pipe, one 32 -bit word at a time, so that
+  // no message is ever buffered in compute kernel
+  q.submit([&](sycl::handler& h) {
+    h.single_task<compute_t>([=]() {
+      using namespace acorn_utils;
+
+      constexpr size_t d_u32_cnt = d_len >> 2;    // 32 -bit word count
+      constexpr size_t d_u08_cnt = d_len & 3ul;   // remaining byte count
+      constexpr size_t ct_u32_cnt = ct_len >> 2;  // 32 -bit word count
+      constexpr size_t ct_u08_cnt = ct_len & 3ul; // remaining byte count
+
+      for (size_t i = 0; i < invk_cnt; i++) {
+        uint8_t key_[16];
+        uint8_t nonce_[16];
+        uint8_t tag_[16];
+
+        read_chunks<ipipe, 16>(key_);
+        read_chunks<ipipe, 16>(nonce_);
+
+        // 293 -bit Acorn-128 state, zero initialize
+        uint64_t state[LFSR_CNT] = { 0ul };
+
+        // see section 1.3.3
+        initialize(state, key_, nonce_);
+
+        // see section 1.3.4
+        word_reader_t<ipipe> data_;
+
+        for (size_t j = 0; j < d_u32_cnt; j++) {
+          state_update<32>(state, data_.next(), MAX_U32, MAX_U32);
+        }
+
+        if constexpr (d_u08_cnt > 0) {
+          const uint32_t word = data_.next();
+
+          for (size_t j = 0; j < d_u08_cnt; j++) {
+            const uint8_t byte = static_cast<uint8_t>(word >> ((3 - j) << 3));
+            state_update<8>(state, byte, MAX_U8, MAX_U8);
+          }
+        }
+
+        append_padding<MAX_U32>(state);
+
+        // see section 1.3.5
+        word_reader_t<ipipe> text_;
+        word_writer_t<opipe> enc_;
+
+        for (size_t j = 0; j < ct_u32_cnt; j++) {
+          const uint32_t dec = text_.next();
+          const uint32_t ks = state_update<32>(state, dec, MAX_U32, MIN_U32);
+
+          enc_.put(dec ^ ks);
+        }
+
+        if constexpr (ct_u08_cnt > 0) {
+          const uint32_t word = text_.next();
+          uint32_t out = 0u;
+
+          for (size_t j = 0; j < ct_u08_cnt; j++) {
+            const size_t sh = (3 - j) << 3;
+            const uint8_t dec = static_cast<uint8_t>(word >> sh);
+            const uint8_t ks = state_update<8>(state, dec, MAX_U8, MIN_U8);
+
+            out |= static_cast<uint32_t>(dec ^ ks) << sh;
+          }
+          enc_.put(out);
+        }
+
+        enc_.flush();
+        append_padding<MIN_U32>(state);
+
+        // see section 1.3.6
+        finalize(state, tag_);
+        write_chunks<opipe, 16>(tag_);
+      }
+    });
+  });
+
+  // output pipe -> global memory
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<writer_t>([=]() [[intel::kernel_args_restrict]] {
+      for (size_t i = 0; i < invk_cnt; i++) {
+        read_chunks<opipe, ct_len>(enc + i * ct_len);
+        read_chunks<opipe, 16>(tag + (i << 4));
+      }
+    });
+  });
+  return evt;
+}
+
+}
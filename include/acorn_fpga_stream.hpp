@@ -0,0 +1,354 @@
+#pragma once
+#include "acorn_fpga.hpp"
+#include "acorn_usm_pool.hpp"
+#include <algorithm>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting FPGA using SYCL/ DPC++, while streaming a
+// large batch of messages through few device buffers, so that host -> device
+// transfer, kernel execution & device -> host transfer of consecutive chunks
+// overlap with each other
+namespace acorn_fpga_stream {
+
+// Device memory, holding one chunk of messages, reused by every `depth` -th
+// chunk of batch
+struct slot_t
+{
+  uint8_t* txt;    // plain text
+  uint8_t* enc;    // encrypted text
+  uint8_t* data;   // associated data
+  uint8_t* keys;   // secret keys
+  uint8_t* nonces; // public message nonces
+  uint8_t* tags;   // authentication tags
+  bool* flags;     // verification flags
+};
+
+// Allocates device memory for a slot, which can hold `chunk_cnt` -many
+// messages, each of given text & associated data byte length; buffers are
+// drawn from `pool`, if one is given
+static inline slot_t
+alloc_slot(sycl::queue& q,
+           const size_t chunk_cnt,
+           const size_t per_invk_ct_len,
+           const size_t per_invk_dt_len,
+           acorn_usm::pool_t* const pool = nullptr)
+{
+  const size_t ct_len = chunk_cnt * per_invk_ct_len;
+  const size_t dt_len = chunk_cnt * per_invk_dt_len;
+  const size_t knt_len = chunk_cnt << 4;
+  const size_t flg_len = chunk_cnt * sizeof(bool);
+
+  slot_t s;
+
+  using namespace acorn_usm;
+
+  s.txt = malloc_device<uint8_t>(ct_len, q, pool);
+  s.enc = malloc_device<uint8_t>(ct_len, q, pool);
+  s.data = malloc_device<uint8_t>(dt_len, q, pool);
+  s.keys = malloc_device<uint8_t>(knt_len, q, pool);
+  s.nonces = malloc_device<uint8_t>(knt_len, q, pool);
+  s.tags = malloc_device<uint8_t>(knt_len, q, pool);
+  s.flags = malloc_device<bool>(flg_len, q, pool);
+
+  return s;
+}
+
+// Deallocates device memory of a slot, handing buffers back to `pool`, if
+// they were drawn from one
+static inline void
+free_slot(sycl::queue& q, slot_t& s, acorn_usm::pool_t* const pool = nullptr)
+{
+  acorn_usm::free(s.txt, q, pool);
+  acorn_usm::free(s.enc, q, pool);
+  acorn_usm::free(s.data, q, pool);
+  acorn_usm::free(s.keys, q, pool);
+  acorn_usm::free(s.nonces, q, pool);
+  acorn_usm::free(s.tags, q, pool);
+  acorn_usm::free(s.flags, q, pool);
+}
+
+// Makes `bytes` -many input bytes, living at `src` on host, visible to a kernel
+// of chunk, which is going to occupy a slot, whose previous occupant's device
+// -> host copies are denoted by `prev`
+//
+// If `src` is USM host/ shared memory, kernel reads it directly ( zero-copy ),
+// otherwise it's copied to slot's device buffer `dst`, whose completion event
+// is appended to `deps`. Returned pointer is what kernel should read from.
+template<typename T>
+static inline const T*
+stage_input(sycl::queue& q,
+            T* const dst,
+            const T* const src,
+            const size_t bytes,
+            const bool zero_copy,
+            const std::vector<sycl::event>& prev,
+            std::vector<sycl::event>& deps)
+{
+  if (zero_copy) {
+    return src;
+  }
+
+  deps.push_back(q.memcpy(dst, src, bytes, prev));
+  return dst;
+}
+
+}
+
+namespace acorn_fpga {
+
+// Acorn-128 authenticated encryption on FPGA, of a batch of N -many equal
+// length messages, residing in host memory, which is sliced into chunks of
+// `chunk_cnt` -many messages ( last one can be shorter ), streamed through
+// `depth` -many device buffers
+//
+// For each chunk, host -> device copy of inputs, `acorn_fpga::encrypt` kernel
+// & device -> host copy of outputs are chained using SYCL events, while a
+// buffer is reused only after outputs of chunk previously occupying it have
+// been copied back. So with `depth` >= 2, transfers of one chunk overlap with
+// kernel execution of another; `depth` = 1 serializes everything.
+//
+// Inputs, which are USM host ( pinned )/ shared allocations, aren't copied to
+// device buffers, instead kernel reads them directly i.e. zero-copy; pageable
+// inputs ( say from `std::malloc` ) are always copied.
+//
+// This routine blocks until whole batch is processed, after which device
+// buffers are released. If `pool` is given, device buffers are drawn from ( and
+// handed back to ) it, so that repeated calls don't allocate device memory.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline void
+stream_encrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys, on host
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces, on host
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text, on host
+  const size_t text_len,                 // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data, on host
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,         // encrypted data bytes, on host
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags, on host
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // # -of messages
+  const size_t chunk_cnt,                // # -of messages per chunk
+  const size_t depth,                    // # -of device buffers
+  acorn_usm::pool_t* pool = nullptr      // device memory pool, optional
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(text_len == enc_len);
+  assert(chunk_cnt > 0 && depth > 0);
+
+  using namespace acorn_fpga_stream;
+
+  const size_t ct_len = text_len / invk_cnt;
+  const size_t dt_len = data_len / invk_cnt;
+
+  // inputs living in USM host/ shared memory are read by kernel directly
+  const bool zc_txt = acorn_usm::host_accessible(text, q);
+  const bool zc_data = acorn_usm::host_accessible(data, q);
+  const bool zc_key = acorn_usm::host_accessible(key, q);
+  const bool zc_nonce = acorn_usm::host_accessible(nonce, q);
+
+  std::vector<slot_t> slots;
+  std::vector<std::vector<sycl::event>> done(depth);
+
+  for (size_t i = 0; i < depth; i++) {
+    slots.push_back(alloc_slot(q, chunk_cnt, ct_len, dt_len, pool));
+  }
+
+  for (size_t c = 0, beg = 0; beg < invk_cnt; c++, beg += chunk_cnt) {
+    const size_t cnt = std::min(chunk_cnt, invk_cnt - beg);
+    const size_t idx = c % depth;
+    slot_t& s = slots[idx];
+
+    const size_t ct_off = beg * ct_len;
+    const size_t dt_off = beg * dt_len;
+    const size_t knt_off = beg << 4;
+
+    const size_t ct_cnt = cnt * ct_len;
+    const size_t dt_cnt = cnt * dt_len;
+    const size_t knt_cnt = cnt << 4;
+
+    // wait for previous occupant of this slot to be copied back, then copy
+    // inputs of this chunk ( unless kernel can read them directly )
+    const std::vector<sycl::event>& prev = done[idx];
+    std::vector<sycl::event> deps{ prev };
+
+    const uint8_t* txt_d =
+      stage_input(q, s.txt, text + ct_off, ct_cnt, zc_txt, prev, deps);
+    const uint8_t* data_d =
+      stage_input(q, s.data, data + dt_off, dt_cnt, zc_data, prev, deps);
+    const uint8_t* keys_d =
+      stage_input(q, s.keys, key + knt_off, knt_cnt, zc_key, prev, deps);
+    const uint8_t* nonces_d =
+      stage_input(q, s.nonces, nonce + knt_off, knt_cnt, zc_nonce, prev, deps);
+
+    sycl::event e0 = encrypt(q,
+                             keys_d,
+                             knt_cnt,
+                             nonces_d,
+                             knt_cnt,
+                             txt_d,
+                             ct_cnt,
+                             data_d,
+                             dt_cnt,
+                             s.enc,
+                             ct_cnt,
+                             s.tags,
+                             knt_cnt,
+                             cnt,
+                             deps);
+
+    sycl::event e1 = q.memcpy(enc + ct_off, s.enc, ct_cnt, e0);
+    sycl::event e2 = q.memcpy(tag + knt_off, s.tags, knt_cnt, e0);
+
+    done[idx] = { e1, e2 };
+  }
+
+  // host synchronization i.e. blocking call !
+  for (auto& evts : done) {
+    sycl::event::wait(evts);
+  }
+
+  for (auto& s : slots) {
+    free_slot(q, s, pool);
+  }
+}
+
+// Acorn-128 verified decryption on FPGA, of a batch of N -many equal length
+// messages, residing in host memory, streamed through `depth` -many device
+// buffers, in chunks of `chunk_cnt` -many messages; see `stream_encrypt` for
+// how transfers & kernel executions are overlapped
+//
+// Inputs, which are USM host ( pinned )/ shared allocations, are read by kernel
+// directly, same as `stream_encrypt` does.
+//
+// This routine blocks until whole batch is processed. After it returns, first
+// verification flags need to be tested for truth value !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline void
+stream_decrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys, on host
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces, on host
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags, on host
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes, on host
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data, on host
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes, on host
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags, on host
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // # -of messages
+  const size_t chunk_cnt,                // # -of messages per chunk
+  const size_t depth,                    // # -of device buffers
+  acorn_usm::pool_t* pool = nullptr      // device memory pool, optional
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+  assert(chunk_cnt > 0 && depth > 0);
+
+  using namespace acorn_fpga_stream;
+
+  const size_t ct_len = enc_len / invk_cnt;
+  const size_t dt_len = data_len / invk_cnt;
+
+  // inputs living in USM host/ shared memory are read by kernel directly
+  const bool zc_enc = acorn_usm::host_accessible(enc, q);
+  const bool zc_data = acorn_usm::host_accessible(data, q);
+  const bool zc_key = acorn_usm::host_accessible(key, q);
+  const bool zc_nonce = acorn_usm::host_accessible(nonce, q);
+  const bool zc_tag = acorn_usm::host_accessible(tag, q);
+
+  std::vector<slot_t> slots;
+  std::vector<std::vector<sycl::event>> done(depth);
+
+  for (size_t i = 0; i < depth; i++) {
+    slots.push_back(alloc_slot(q, chunk_cnt, ct_len, dt_len, pool));
+  }
+
+  for (size_t c = 0, beg = 0; beg < invk_cnt; c++, beg += chunk_cnt) {
+    const size_t cnt = std::min(chunk_cnt, invk_cnt - beg);
+    const size_t idx = c % depth;
+    slot_t& s = slots[idx];
+
+    const size_t ct_off = beg * ct_len;
+    const size_t dt_off = beg * dt_len;
+    const size_t knt_off = beg << 4;
+
+    const size_t ct_cnt = cnt * ct_len;
+    const size_t dt_cnt = cnt * dt_len;
+    const size_t knt_cnt = cnt << 4;
+    const size_t flg_cnt = cnt * sizeof(bool);
+
+    // wait for previous occupant of this slot to be copied back, then copy
+    // inputs of this chunk ( unless kernel can read them directly ); slot's
+    // `enc` buffer holds encrypted text, while its `txt` buffer receives
+    // decrypted text
+    const std::vector<sycl::event>& prev = done[idx];
+    std::vector<sycl::event> deps{ prev };
+
+    const uint8_t* enc_d =
+      stage_input(q, s.enc, enc + ct_off, ct_cnt, zc_enc, prev, deps);
+    const uint8_t* data_d =
+      stage_input(q, s.data, data + dt_off, dt_cnt, zc_data, prev, deps);
+    const uint8_t* keys_d =
+      stage_input(q, s.keys, key + knt_off, knt_cnt, zc_key, prev, deps);
+    const uint8_t* nonces_d =
+      stage_input(q, s.nonces, nonce + knt_off, knt_cnt, zc_nonce, prev, deps);
+    const uint8_t* tags_d =
+      stage_input(q, s.tags, tag + knt_off, knt_cnt, zc_tag, prev, deps);
+
+    sycl::event e0 = decrypt(q,
+                             keys_d,
+                             knt_cnt,
+                             nonces_d,
+                             knt_cnt,
+                             tags_d,
+                             knt_cnt,
+                             enc_d,
+                             ct_cnt,
+                             data_d,
+                             dt_cnt,
+                             s.txt,
+                             ct_cnt,
+                             s.flags,
+                             flg_cnt,
+                             cnt,
+                             deps);
+
+    sycl::event e1 = q.memcpy(text + ct_off, s.txt, ct_cnt, e0);
+    sycl::event e2 = q.memcpy(flag + beg, s.flags, flg_cnt, e0);
+
+    done[idx] = { e1, e2 };
+  }
+
+  // host synchronization i.e. blocking call !
+  for (auto& evts : done) {
+    sycl::event::wait(evts);
+  }
+
+  for (auto& s : slots) {
+    free_slot(q, s, pool);
+  }
+}
+
+}
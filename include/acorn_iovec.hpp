@@ -0,0 +1,312 @@
+#pragma once
+#include "acorn_stream.hpp"
+#include <cassert>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ), consuming associated data & plain/ cipher text from
+// scatter/ gather lists of memory segments, without copying them into a
+// contiguous staging buffer first
+namespace acorn {
+
+// Read-only memory segment, an element of gather list
+struct iovec_t
+{
+  const uint8_t* base; // first byte of segment
+  size_t len;          // # -of bytes in segment, can be >= 0
+};
+
+// Writable memory segment, an element of scatter list
+struct iovec_mut_t
+{
+  uint8_t* base; // first byte of segment
+  size_t len;    // # -of bytes in segment, can be >= 0
+};
+
+}
+
+namespace acorn_iovec {
+
+// Position inside a scatter/ gather list, as segment index & byte offset inside
+// that segment
+template<typename seg_t>
+struct cursor_t
+{
+  const seg_t* segs; // scatter/ gather list
+  size_t cnt;        // # -of segments in list
+  size_t idx;        // current segment
+  size_t off;        // current byte offset inside current segment
+};
+
+// Total # -of bytes in scatter/ gather list
+template<typename seg_t>
+static inline size_t
+total_len(const seg_t* const segs, const size_t cnt)
+{
+  size_t len = 0;
+  for (size_t i = 0; i < cnt; i++) {
+    len += segs[i].len;
+  }
+  return len;
+}
+
+// Moves cursor past exhausted ( or empty ) segments, returning # -of bytes
+// which can be accessed contiguously, starting at current position
+template<typename seg_t>
+static inline size_t
+contiguous(cursor_t<seg_t>& c)
+{
+  while ((c.idx < c.cnt) && (c.off == c.segs[c.idx].len)) {
+    c.idx++;
+    c.off = 0;
+  }
+
+  return c.idx < c.cnt ? c.segs[c.idx].len - c.off : 0;
+}
+
+// Copies `n` bytes, starting at current position of gather list, into `dst`,
+// crossing segment boundaries as needed
+static inline void
+gather(cursor_t<acorn::iovec_t>& c,
+       uint8_t* const __restrict dst,
+       const size_t n)
+{
+  for (size_t i = 0; i < n; i++) {
+    contiguous(c);
+    dst[i] = c.segs[c.idx].base[c.off++];
+  }
+}
+
+// Copies `n` bytes from `src` to current position of scatter list, crossing
+// segment boundaries as needed
+static inline void
+scatter(cursor_t<acorn::iovec_mut_t>& c,
+        const uint8_t* const __restrict src,
+        const size_t n)
+{
+  for (size_t i = 0; i < n; i++) {
+    contiguous(c);
+    c.segs[c.idx].base[c.off++] = src[i];
+  }
+}
+
+// Processing the associated data bytes of gather list, following algorithm
+// described in section 1.3.4 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// State is updated 32 -bits at a time, as long as at least 4 bytes are left,
+// irrespective of segment boundaries, so that it matches
+// `acorn_utils::process_associated_data`, on concatenated segments. Words
+// lying inside a single segment are read in place, only ones straddling
+// segment boundaries are gathered byte-by-byte.
+static inline void
+process_associated_data(
+  uint64_t* const __restrict state,            // 293 -bit state
+  const acorn::iovec_t* const __restrict data, // associated data segments
+  const size_t d_cnt                           // # -of segments, can be >= 0
+)
+{
+  using namespace acorn_utils;
+
+  cursor_t<acorn::iovec_t> c{ data, d_cnt, 0, 0 };
+  size_t rem = total_len(data, d_cnt);
+
+  while (rem >= 4) {
+    const size_t n = contiguous(c);
+
+    if (n >= 4) {
+      const size_t u32_cnt = n >> 2; // 32 -bit chunk count
+      const uint8_t* const ptr = c.segs[c.idx].base + c.off;
+
+      for (size_t i = 0; i < u32_cnt; i++) {
+        const uint32_t word = from_be_bytes(ptr + (i << 2));
+        state_update<32>(state, word, MAX_U32, MAX_U32);
+      }
+
+      c.off += u32_cnt << 2;
+      rem -= u32_cnt << 2;
+    } else {
+      uint8_t word[4];
+      gather(c, word, 4);
+
+      state_update<32>(state, from_be_bytes(word), MAX_U32, MAX_U32);
+      rem -= 4;
+    }
+  }
+
+  for (size_t i = 0; i < rem; i++) {
+    uint8_t byte = 0;
+    gather(c, &byte, 1);
+
+    state_update<8>(state, byte, MAX_U8, MAX_U8);
+  }
+
+  // line 2, 3 of step 1; append single `1` -bit, followed by 255 `0` -bits
+  append_padding<MAX_U32>(state);
+}
+
+// Encrypts/ decrypts ( choose using template parameter ) bytes of gather list
+// `in` & writes them to scatter list `out`, following algorithm defined in
+// section 1.3.5 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// Both lists must hold same total # -of bytes, though they may be segmented
+// differently. State is updated 32 -bits at a time, as long as at least 4
+// bytes are left, so that it matches `acorn_utils::process_{plain,
+// cipher}_text`, on concatenated segments. Words lying inside a single input
+// segment & a single output segment are processed in place, only ones
+// straddling segment boundaries are gathered/ scattered byte-by-byte.
+template<const bool encrypt>
+static inline void
+process_text(uint64_t* const __restrict state,               // 293 -bit state
+             const acorn::iovec_t* const __restrict in,      // input segments
+             const size_t in_cnt,                            // # -of segments
+             const acorn::iovec_mut_t* const __restrict out, // output segments
+             const size_t out_cnt                            // # -of segments
+)
+{
+  using namespace acorn_stream;
+
+  cursor_t<acorn::iovec_t> ci{ in, in_cnt, 0, 0 };
+  cursor_t<acorn::iovec_mut_t> co{ out, out_cnt, 0, 0 };
+  size_t rem = total_len(in, in_cnt);
+
+  // output list must be able to hold all processed bytes, exactly
+  assert(rem == total_len(out, out_cnt));
+
+  while (rem >= 4) {
+    const size_t ni = contiguous(ci);
+    const size_t no = contiguous(co);
+
+    if ((ni >= 4) && (no >= 4)) {
+      const size_t u32_cnt = std::min(ni, no) >> 2; // 32 -bit chunk count
+      const uint8_t* const iptr = ci.segs[ci.idx].base + ci.off;
+      uint8_t* const optr = co.segs[co.idx].base + co.off;
+
+      for (size_t i = 0; i < u32_cnt; i++) {
+        process_word<encrypt>(state, iptr + (i << 2), optr + (i << 2));
+      }
+
+      ci.off += u32_cnt << 2;
+      co.off += u32_cnt << 2;
+      rem -= u32_cnt << 2;
+    } else {
+      uint8_t iword[4];
+      uint8_t oword[4];
+
+      gather(ci, iword, 4);
+      process_word<encrypt>(state, iword, oword);
+      scatter(co, oword, 4);
+
+      rem -= 4;
+    }
+  }
+
+  for (size_t i = 0; i < rem; i++) {
+    uint8_t byte = 0;
+    gather(ci, &byte, 1);
+
+    byte = process_byte<encrypt>(state, byte);
+    scatter(co, &byte, 1);
+  }
+
+  // line 2, 3 of step 1; append single `1` -bit, followed by 255 `0` -bits
+  acorn_utils::append_padding<acorn_utils::MIN_U32>(state);
+}
+
+}
+
+namespace acorn {
+
+// Acorn-128 authenticated encryption, same as `encrypt`, but plain text &
+// associated data are read from gather lists, while encrypted text is written
+// to scatter list
+//
+// Total # -of bytes in `text` & `cipher` lists must match, though they can be
+// segmented differently; empty segments are allowed. Note, assert total
+// length of `text` == total length of `cipher`
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline void
+encryptv(const uint8_t* const __restrict key,        // 128 -bit secret key
+         const uint8_t* const __restrict nonce,      // 128 -bit message nonce
+         const iovec_t* const __restrict text,       // plain text segments
+         const size_t t_cnt,                         // # -of text segments
+         const iovec_t* const __restrict data,       // associated data segments
+         const size_t d_cnt,                         // # -of data segments
+         const iovec_mut_t* const __restrict cipher, // encrypted segments
+         const size_t c_cnt,                         // # -of cipher segments
+         uint8_t* const __restrict tag               // 128 -bit auth tag
+)
+{
+  using namespace acorn_iovec;
+
+  // scatter list must be able to hold all encrypted bytes, exactly
+  assert(total_len(text, t_cnt) == total_len(cipher, c_cnt));
+
+  // 293 -bit Acorn-128 state, zero initialize
+  uint64_t state[acorn_utils::LFSR_CNT] = { 0ul };
+
+  // see section 1.3.3
+  acorn_utils::initialize(state, key, nonce);
+  // see section 1.3.4
+  acorn_iovec::process_associated_data(state, data, d_cnt);
+  // see section 1.3.5
+  acorn_iovec::process_text<true>(state, text, t_cnt, cipher, c_cnt);
+  // see section 1.3.6
+  acorn_utils::finalize(state, tag);
+}
+
+// Acorn-128 verified decryption, same as `decrypt`, but encrypted text &
+// associated data are read from gather lists, while decrypted text is written
+// to scatter list, returning boolean verification flag `f`
+//
+// Total # -of bytes in `cipher` & `text` lists must match, though they can be
+// segmented differently; empty segments are allowed. Note, assert total
+// length of `cipher` == total length of `text`
+//
+// Always ensure `assert f`, otherwise something is off !
+//
+// See algorithms defined in section 1.3.{3,4,5,6} of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline bool
+decryptv(const uint8_t* const __restrict key,      // 128 -bit secret key
+         const uint8_t* const __restrict nonce,    // 128 -bit message nonce
+         const uint8_t* const __restrict tag,      // 128 -bit auth tag
+         const iovec_t* const __restrict cipher,   // encrypted segments
+         const size_t c_cnt,                       // # -of cipher segments
+         const iovec_t* const __restrict data,     // associated data segments
+         const size_t d_cnt,                       // # -of data segments
+         const iovec_mut_t* const __restrict text, // decrypted segments
+         const size_t t_cnt                        // # -of text segments
+)
+{
+  using namespace acorn_iovec;
+
+  // scatter list must be able to hold all decrypted bytes, exactly
+  assert(total_len(cipher, c_cnt) == total_len(text, t_cnt));
+
+  // 293 -bit Acorn-128 state, zero initialize
+  uint64_t state[acorn_utils::LFSR_CNT] = { 0ul };
+  // 128 -bit authentication tag
+  uint8_t tag_[16];
+
+  // see section 1.3.3
+  acorn_utils::initialize(state, key, nonce);
+  // see section 1.3.4
+  acorn_iovec::process_associated_data(state, data, d_cnt);
+  // see section 1.3.5
+  acorn_iovec::process_text<false>(state, cipher, c_cnt, text, t_cnt);
+  // see section 1.3.6
+  acorn_utils::finalize(state, tag_);
+
+  // verification flag
+  bool fail = false;
+  // compare authentication tag byte-by-byte
+  for (size_t i = 0; i < 16; i++) {
+    fail |= static_cast<bool>(tag[i] ^ tag_[i]);
+  }
+  return !fail;
+}
+
+}
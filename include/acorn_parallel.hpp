@@ -0,0 +1,547 @@
+#pragma once
+#include "acorn_simd.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ), processing many independent messages on all CPU cores
+// using a reusable pool of worker threads
+namespace acorn_parallel {
+
+// Fixed size pool of worker threads, which are spawned once & reused across
+// jobs, so that thread creation cost isn't paid per batch of messages
+//
+// A job is a callable, which is invoked once by each of `width()` -many
+// participants ( all workers & the calling thread ), with participant index
+// in [0, width()) passed as argument. `run` returns only after all of them
+// have finished.
+//
+// Note, `run` isn't reentrant, jobs submitted from multiple threads, to same
+// pool, are serialized.
+class thread_pool_t
+{
+private:
+  std::vector<std::thread> workers;
+  std::mutex lock;
+  std::mutex submit;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+  const std::function<void(size_t)>* job = nullptr;
+  size_t generation = 0; // bumped when a new job is published
+  size_t pending = 0;    // # -of workers yet to finish current job
+  bool stop = false;
+
+  // Worker thread body, waiting for a new job to be published & invoking it
+  void work(const size_t idx)
+  {
+    size_t seen = 0;
+
+    while (true) {
+      const std::function<void(size_t)>* job_ = nullptr;
+
+      {
+        std::unique_lock<std::mutex> g{ lock };
+        start_cv.wait(g, [&] { return stop || (generation != seen); });
+
+        if (stop) {
+          return;
+        }
+
+        seen = generation;
+        job_ = job;
+      }
+
+      (*job_)(idx);
+
+      {
+        std::lock_guard<std::mutex> g{ lock };
+        pending--;
+        if (pending == 0) {
+          done_cv.notify_one();
+        }
+      }
+    }
+  }
+
+public:
+  // Spawns `worker_cnt` -many threads; calling thread also takes part in each
+  // job, so pass ( # -of cores - 1 ) for using all cores
+  explicit thread_pool_t(const size_t worker_cnt)
+  {
+    workers.reserve(worker_cnt);
+    for (size_t i = 0; i < worker_cnt; i++) {
+      workers.emplace_back(&thread_pool_t::work, this, i + 1);
+    }
+  }
+
+  thread_pool_t(const thread_pool_t&) = delete;
+  thread_pool_t& operator=(const thread_pool_t&) = delete;
+
+  ~thread_pool_t()
+  {
+    {
+      std::lock_guard<std::mutex> g{ lock };
+      stop = true;
+    }
+    start_cv.notify_all();
+
+    for (auto& w : workers) {
+      w.join();
+    }
+  }
+
+  // # -of participants of each job i.e. worker threads & the calling thread
+  size_t width() const { return workers.size() + 1; }
+
+  // Invokes `f(i)` for each i in [0, width()), concurrently, where f(0) is run
+  // on calling thread; returns once all invocations have finished
+  void run(const std::function<void(size_t)>& f)
+  {
+    std::lock_guard<std::mutex> s{ submit };
+
+    {
+      std::lock_guard<std::mutex> g{ lock };
+      job = &f;
+      pending = workers.size();
+      generation++;
+    }
+    start_cv.notify_all();
+
+    f(0);
+
+    std::unique_lock<std::mutex> g{ lock };
+    done_cv.wait(g, [&] { return pending == 0; });
+  }
+};
+
+// Process-wide pool, spawned on first use, whose participants occupy all
+// available CPU cores
+static inline thread_pool_t&
+default_pool()
+{
+  const size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+  static thread_pool_t pool{ cores - 1 };
+  return pool;
+}
+
+// Splits `msg_cnt` -many messages into `width` -many contiguous chunks of
+// nearly equal length, returning [beg, end) message range of `idx` -th chunk
+//
+// Chunk boundaries are aligned to `acorn_simd::LANE_CNT`, so that each chunk
+// can be processed in SIMD lockstep, leaving only last chunk with leftover
+// messages.
+static inline std::pair<size_t, size_t>
+chunk(const size_t msg_cnt, const size_t width, const size_t idx)
+{
+  constexpr size_t lanes = acorn_simd::LANE_CNT;
+
+  const size_t grp_cnt = (msg_cnt + lanes - 1) / lanes; // lane groups
+  const size_t per_chunk = grp_cnt / width;
+  const size_t rem = grp_cnt % width;
+
+  // first `rem` chunks get one lane group more than rest
+  const size_t beg = idx * per_chunk + std::min(idx, rem);
+  const size_t end = beg + per_chunk + (idx < rem);
+
+  return { std::min(beg * lanes, msg_cnt), std::min(end * lanes, msg_cnt) };
+}
+
+// How messages of a ragged batch ( i.e. messages of varying length ) are
+// distributed among participants of thread pool
+enum class schedule_t
+{
+  static_chunk, // equal # -of messages per participant, decided upfront
+  work_stealing // cost balanced tasks per participant, idle ones steal
+};
+
+// Estimated cost of Acorn-128 encryption/ decryption of a message, in terms of
+// # -of state updates, where 32 -bit & 8 -bit updates are counted same
+//
+// Fixed part is due to initialization ( 56 updates, see section 1.3.3 ),
+// padding of both associated data & text ( 9 updates each ) & finalization (
+// 24 updates, see section 1.3.6 ), while rest is proportional to length.
+static inline size_t
+cost(const size_t ct_len, const size_t d_len)
+{
+  constexpr size_t fixed = 56ul + 9ul + 9ul + 24ul;
+
+  const size_t ct_cnt = (ct_len >> 2) + (ct_len & 3ul);
+  const size_t d_cnt = (d_len >> 2) + (d_len & 3ul);
+
+  return fixed + ct_cnt + d_cnt;
+}
+
+// Contiguous range of messages [beg, end), which is processed as one unit of
+// work, along with its estimated cost
+struct task_t
+{
+  size_t beg;
+  size_t end;
+  size_t cost;
+};
+
+// Per participant queue of tasks, from whose front owner pops tasks, while
+// other participants, having run out of their own tasks, steal from back
+class task_queue_t
+{
+private:
+  std::mutex lock;
+  std::deque<task_t> tasks;
+
+public:
+  void push(const task_t t)
+  {
+    std::lock_guard<std::mutex> g{ lock };
+    tasks.push_back(t);
+  }
+
+  bool pop(task_t& t)
+  {
+    std::lock_guard<std::mutex> g{ lock };
+    if (tasks.empty()) {
+      return false;
+    }
+
+    t = tasks.front();
+    tasks.pop_front();
+    return true;
+  }
+
+  bool steal(task_t& t)
+  {
+    std::lock_guard<std::mutex> g{ lock };
+    if (tasks.empty()) {
+      return false;
+    }
+
+    t = tasks.back();
+    tasks.pop_back();
+    return true;
+  }
+};
+
+// Groups consecutive messages of a ragged batch into tasks, each of estimated
+// cost >= `grain` ( except possibly last one ), so that short messages are
+// batched together, while a long message forms a task by itself
+//
+// `i` -th message has `ct_off[i + 1] - ct_off[i]` -bytes text &
+// `d_off[i + 1] - d_off[i]` -bytes associated data.
+static inline std::vector<task_t>
+make_tasks(const size_t* const __restrict ct_off, // text offsets
+           const size_t* const __restrict d_off,  // associated data offsets
+           const size_t msg_cnt,                  // # -of messages
+           const size_t grain                     // min cost of a task
+)
+{
+  std::vector<task_t> tasks;
+  task_t t{ 0, 0, 0 };
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t ct_len = ct_off[i + 1] - ct_off[i];
+    const size_t d_len = d_off[i + 1] - d_off[i];
+
+    t.end = i + 1;
+    t.cost += cost(ct_len, d_len);
+
+    if (t.cost >= grain) {
+      tasks.push_back(t);
+      t = task_t{ i + 1, i + 1, 0 };
+    }
+  }
+
+  if (t.end > t.beg) {
+    tasks.push_back(t);
+  }
+
+  return tasks;
+}
+
+// Invokes `f(i)` for each message i in [0, msg_cnt) of a ragged batch, on
+// participants of thread pool, as per chosen scheduling policy
+//
+// With work stealing, messages are grouped into ~8 tasks per participant (
+// see `make_tasks` ), which are handed out so that each participant starts
+// with contiguous tasks of nearly equal total cost; once a participant has
+// drained its own queue, it steals from others, until all queues are empty.
+template<typename fn_t>
+static inline void
+run_ragged(thread_pool_t& pool,                   // worker threads
+           const size_t* const __restrict ct_off, // text offsets
+           const size_t* const __restrict d_off,  // associated data offsets
+           const size_t msg_cnt,                  // # -of messages
+           const schedule_t sched,                // scheduling policy
+           const fn_t& f                          // processes a message
+)
+{
+  const size_t width = pool.width();
+
+  if (sched == schedule_t::static_chunk) {
+    pool.run([&](const size_t idx) {
+      const size_t beg = (idx * msg_cnt) / width;
+      const size_t end = ((idx + 1) * msg_cnt) / width;
+
+      for (size_t i = beg; i < end; i++) {
+        f(i);
+      }
+    });
+    return;
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < msg_cnt; i++) {
+    total += cost(ct_off[i + 1] - ct_off[i], d_off[i + 1] - d_off[i]);
+  }
+
+  const size_t grain = std::max(total / (width << 3), 1ul);
+  const auto tasks = make_tasks(ct_off, d_off, msg_cnt, grain);
+
+  std::vector<task_queue_t> queues(width);
+
+  // `j` -th participant is seeded with tasks, whose cost mid-point falls in
+  // [j * total / width, (j + 1) * total / width)
+  size_t acc = 0;
+  for (const auto& t : tasks) {
+    const size_t mid = acc + (t.cost >> 1);
+    const size_t owner = std::min((mid * width) / total, width - 1);
+
+    queues[owner].push(t);
+    acc += t.cost;
+  }
+
+  pool.run([&](const size_t idx) {
+    task_t t{ 0, 0, 0 };
+
+    // drain own queue first, then steal from others, in round-robin order
+    for (size_t k = 0; k < width; k++) {
+      task_queue_t& q = queues[(idx + k) % width];
+
+      while ((k == 0) ? q.pop(t) : q.steal(t)) {
+        for (size_t i = t.beg; i < t.end; i++) {
+          f(i);
+        }
+      }
+    }
+  });
+}
+
+}
+
+namespace acorn {
+
+// Acorn-128 authenticated encryption of N -many independent, equal-length
+// messages, on all cores of host CPU
+//
+// Arguments are laid out same as `acorn_fpga::encrypt` i.e. `i` -th message
+// uses key & nonce at offset `i * 16`, plain text & encrypted text at offset
+// `i * (text_len / invk_cnt)`, associated data at offset `i * (data_len /
+// invk_cnt)` & writes its tag at offset `i * 16`.
+//
+// Messages are split into one contiguous chunk per participant of thread pool,
+// each of which is processed using `acorn::batch_encrypt`.
+static inline void
+parallel_encrypt(
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // # -of messages
+  acorn_parallel::thread_pool_t& pool = acorn_parallel::default_pool()
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len == enc_len);
+
+  if (invk_cnt == 0) {
+    return;
+  }
+
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+
+  const size_t ct_len = text_len / invk_cnt;
+  const size_t d_len = data_len / invk_cnt;
+  const size_t width = pool.width();
+
+  pool.run([&](const size_t idx) {
+    const auto [beg, end] = acorn_parallel::chunk(invk_cnt, width, idx);
+
+    batch_encrypt(key + (beg << 4),
+                  nonce + (beg << 4),
+                  text + beg * ct_len,
+                  ct_len,
+                  data + beg * d_len,
+                  d_len,
+                  enc + beg * ct_len,
+                  tag + (beg << 4),
+                  end - beg);
+  });
+}
+
+// Acorn-128 verified decryption of N -many independent, equal-length messages,
+// on all cores of host CPU, writing `i` -th verification flag to `flag[i]` &
+// returning truth value only when all messages are verified
+//
+// Arguments are laid out same as `acorn_fpga::decrypt`; see `parallel_encrypt`
+// for how messages are split among threads.
+//
+// Always ensure `assert flag[i]`, before consuming `i` -th decrypted text !
+static inline bool
+parallel_decrypt(
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // # -of messages
+  acorn_parallel::thread_pool_t& pool = acorn_parallel::default_pool()
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+
+  if (invk_cnt == 0) {
+    return true;
+  }
+
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+
+  const size_t ct_len = enc_len / invk_cnt;
+  const size_t d_len = data_len / invk_cnt;
+  const size_t width = pool.width();
+
+  pool.run([&](const size_t idx) {
+    const auto [beg, end] = acorn_parallel::chunk(invk_cnt, width, idx);
+
+    batch_decrypt(key + (beg << 4),
+                  nonce + (beg << 4),
+                  tag + (beg << 4),
+                  enc + beg * ct_len,
+                  ct_len,
+                  data + beg * d_len,
+                  d_len,
+                  text + beg * ct_len,
+                  flag + beg,
+                  end - beg);
+  });
+
+  return std::all_of(flag, flag + invk_cnt, [](const bool f) { return f; });
+}
+
+// Acorn-128 authenticated encryption of N -many independent messages of
+// varying length ( read ragged batch ), on all cores of host CPU
+//
+// Text & associated data of all messages are packed back to back, where
+// `i` -th message's text lives in [text_off[i], text_off[i + 1]) of `text`
+// ( also where its encrypted text is written in `enc` ) & its associated data
+// lives in [data_off[i], data_off[i + 1]) of `data`; both offset arrays hold
+// N + 1 entries, starting with 0. Key, nonce & tag of `i` -th message are at
+// offset `i * 16`.
+//
+// By default, work stealing is used, so that a few long messages don't leave
+// most threads idle; see `acorn_parallel::run_ragged`.
+static inline void
+parallel_encrypt_ragged(
+  const uint8_t* const __restrict key,     // secret keys
+  const uint8_t* const __restrict nonce,   // public nonces
+  const uint8_t* const __restrict text,    // plain text
+  const size_t* const __restrict text_off, // N + 1 text offsets
+  const uint8_t* const __restrict data,    // associated data
+  const size_t* const __restrict data_off, // N + 1 associated data offsets
+  uint8_t* const __restrict enc,           // encrypted data bytes
+  uint8_t* const __restrict tag,           // authentication tags
+  const size_t msg_cnt,                    // # -of messages
+  acorn_parallel::thread_pool_t& pool = acorn_parallel::default_pool(),
+  const acorn_parallel::schedule_t sched =
+    acorn_parallel::schedule_t::work_stealing)
+{
+  if (msg_cnt == 0) {
+    return;
+  }
+
+  auto f = [&](const size_t i) {
+    encrypt(key + (i << 4),
+            nonce + (i << 4),
+            text + text_off[i],
+            text_off[i + 1] - text_off[i],
+            data + data_off[i],
+            data_off[i + 1] - data_off[i],
+            enc + text_off[i],
+            tag + (i << 4));
+  };
+
+  acorn_parallel::run_ragged(pool, text_off, data_off, msg_cnt, sched, f);
+}
+
+// Acorn-128 verified decryption of N -many independent messages of varying
+// length ( read ragged batch ), on all cores of host CPU, writing `i` -th
+// verification flag to `flag[i]` & returning truth value only when all
+// messages are verified
+//
+// Memory layout is same as described on top of `parallel_encrypt_ragged`.
+//
+// Always ensure `assert flag[i]`, before consuming `i` -th decrypted text !
+static inline bool
+parallel_decrypt_ragged(
+  const uint8_t* const __restrict key,     // secret keys
+  const uint8_t* const __restrict nonce,   // public nonces
+  const uint8_t* const __restrict tag,     // authentication tags
+  const uint8_t* const __restrict enc,     // encrypted data bytes
+  const size_t* const __restrict text_off, // N + 1 text offsets
+  const uint8_t* const __restrict data,    // associated data
+  const size_t* const __restrict data_off, // N + 1 associated data offsets
+  uint8_t* const __restrict text,          // plain text bytes
+  bool* const __restrict flag,             // verification flags
+  const size_t msg_cnt,                    // # -of messages
+  acorn_parallel::thread_pool_t& pool = acorn_parallel::default_pool(),
+  const acorn_parallel::schedule_t sched =
+    acorn_parallel::schedule_t::work_stealing)
+{
+  if (msg_cnt == 0) {
+    return true;
+  }
+
+  auto f = [&](const size_t i) {
+    flag[i] = decrypt(key + (i << 4),
+                      nonce + (i << 4),
+                      tag + (i << 4),
+                      enc + text_off[i],
+                      text_off[i + 1] - text_off[i],
+                      data + data_off[i],
+                      data_off[i + 1] - data_off[i],
+                      text + text_off[i]);
+  };
+
+  acorn_parallel::run_ragged(pool, text_off, data_off, msg_cnt, sched, f);
+
+  return std::all_of(flag, flag + msg_cnt, [](const bool ok) { return ok; });
+}
+
+}
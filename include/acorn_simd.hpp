@@ -0,0 +1,728 @@
+#pragma once
+#include "acorn.hpp"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ), running multiple independent instances in lockstep
+// using SIMD registers
+//
+// Seven u64 words of Acorn-128 state are kept in structure-of-arrays form i.e.
+// i-th vector register holds i-th LFSR word of 4 ( AVX2 ) or 8 ( AVX-512 )
+// independent messages, side by side. When neither of those instruction sets
+// is enabled during compilation, batch routines fall back to invoking
+// `acorn::{encrypt, decrypt}`, one message at a time.
+namespace acorn_simd {
+
+#if defined(__AVX512F__)
+
+// These many Acorn-128 instances are run in lockstep
+constexpr size_t LANE_CNT = 8ul;
+
+// Vector register, holding same LFSR word of `LANE_CNT` -many messages
+using vec_t = __m512i;
+
+static inline vec_t
+vset1(const uint64_t a)
+{
+  return _mm512_set1_epi64(static_cast<long long>(a));
+}
+
+static inline vec_t
+vload(const uint64_t* const a)
+{
+  return _mm512_loadu_si512(a);
+}
+
+static inline void
+vstore(uint64_t* const a, const vec_t v)
+{
+  _mm512_storeu_si512(a, v);
+}
+
+// Note, zero-masking form of shift instructions is used ( with all lanes
+// active ), which compiles to same unmasked instruction, but keeps GCC from
+// falsely reporting use of uninitialized `_mm512_undefined_epi32` source
+template<const int n>
+static inline vec_t
+vshr(const vec_t v)
+{
+  return _mm512_maskz_srli_epi64(0xff, v, n);
+}
+
+template<const int n>
+static inline vec_t
+vshl(const vec_t v)
+{
+  return _mm512_maskz_slli_epi64(0xff, v, n);
+}
+
+static inline vec_t
+vand(const vec_t a, const vec_t b)
+{
+  return _mm512_and_si512(a, b);
+}
+
+static inline vec_t
+vor(const vec_t a, const vec_t b)
+{
+  return _mm512_or_si512(a, b);
+}
+
+static inline vec_t
+vxor(const vec_t a, const vec_t b)
+{
+  return _mm512_xor_si512(a, b);
+}
+
+// a ^ b ^ c, using single ternary logic instruction
+static inline vec_t
+vxor3(const vec_t a, const vec_t b, const vec_t c)
+{
+  return _mm512_ternarylogic_epi64(a, b, c, 0x96);
+}
+
+// a ^ ~b ^ c, using single ternary logic instruction
+static inline vec_t
+vxnor3(const vec_t a, const vec_t b, const vec_t c)
+{
+  return _mm512_ternarylogic_epi64(a, b, c, 0x69);
+}
+
+// Acorn function `maj`, using single ternary logic instruction; see
+// `acorn_utils::maj`
+static inline vec_t
+maj(const vec_t x, const vec_t y, const vec_t z)
+{
+  return _mm512_ternarylogic_epi64(x, y, z, 0xe8);
+}
+
+// Acorn function `ch`, using single ternary logic instruction; see
+// `acorn_utils::ch`
+static inline vec_t
+ch(const vec_t x, const vec_t y, const vec_t z)
+{
+  return _mm512_ternarylogic_epi64(x, y, z, 0xca);
+}
+
+#elif defined(__AVX2__)
+
+// These many Acorn-128 instances are run in lockstep
+constexpr size_t LANE_CNT = 4ul;
+
+// Vector register, holding same LFSR word of `LANE_CNT` -many messages
+using vec_t = __m256i;
+
+static inline vec_t
+vset1(const uint64_t a)
+{
+  return _mm256_set1_epi64x(static_cast<long long>(a));
+}
+
+static inline vec_t
+vload(const uint64_t* const a)
+{
+  return _mm256_loadu_si256(reinterpret_cast<const vec_t*>(a));
+}
+
+static inline void
+vstore(uint64_t* const a, const vec_t v)
+{
+  _mm256_storeu_si256(reinterpret_cast<vec_t*>(a), v);
+}
+
+template<const int n>
+static inline vec_t
+vshr(const vec_t v)
+{
+  return _mm256_srli_epi64(v, n);
+}
+
+template<const int n>
+static inline vec_t
+vshl(const vec_t v)
+{
+  return _mm256_slli_epi64(v, n);
+}
+
+static inline vec_t
+vand(const vec_t a, const vec_t b)
+{
+  return _mm256_and_si256(a, b);
+}
+
+static inline vec_t
+vor(const vec_t a, const vec_t b)
+{
+  return _mm256_or_si256(a, b);
+}
+
+static inline vec_t
+vxor(const vec_t a, const vec_t b)
+{
+  return _mm256_xor_si256(a, b);
+}
+
+// a ^ b ^ c
+static inline vec_t
+vxor3(const vec_t a, const vec_t b, const vec_t c)
+{
+  return vxor(vxor(a, b), c);
+}
+
+// a ^ ~b ^ c
+static inline vec_t
+vxnor3(const vec_t a, const vec_t b, const vec_t c)
+{
+  return vxor(vxor(a, vxor(b, vset1(acorn_utils::MAX_U64))), c);
+}
+
+// Acorn function `maj`; see `acorn_utils::maj`
+static inline vec_t
+maj(const vec_t x, const vec_t y, const vec_t z)
+{
+  return vxor3(vand(x, y), vand(x, z), vand(y, z));
+}
+
+// Acorn function `ch`; see `acorn_utils::ch`
+static inline vec_t
+ch(const vec_t x, const vec_t y, const vec_t z)
+{
+  return vxor(vand(x, y), _mm256_andnot_si256(x, z));
+}
+
+#endif
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+
+// Generate 32 keystream bits for each lane, in lower half of each 64 -bit
+// vector lane; see `acorn_utils::ksg128`
+static inline vec_t
+ksg128(const vec_t* const state)
+{
+  const vec_t w235 = vshr<5>(state[5]);
+  const vec_t w111 = vshr<4>(state[2]);
+  const vec_t w66 = vshr<5>(state[1]);
+  const vec_t w12 = vshr<12>(state[0]);
+
+  const vec_t w0 = maj(w235, state[1], state[4]);
+  const vec_t w1 = ch(state[5], w111, w66);
+  return vxor(vxor3(w12, state[3], w0), w1);
+}
+
+// Compute 32 feedback bits for each lane, in lower half of each 64 -bit vector
+// lane; see `acorn_utils::fbk128`
+static inline vec_t
+fbk128(const vec_t* const state, // SoA state of `LANE_CNT` messages
+       const vec_t ca,           // control bits `a`
+       const vec_t cb,           // control bits `b`
+       const vec_t ks            // key stream bits, see `ksg128`
+)
+{
+  const vec_t w244 = vshr<14>(state[5]);
+  const vec_t w23 = vshr<23>(state[0]);
+  const vec_t w160 = vshr<6>(state[3]);
+  const vec_t w196 = vshr<3>(state[4]);
+
+  const vec_t w0 = maj(w244, w23, w160);
+  const vec_t w1 = vand(cb, ks);
+  const vec_t w2 = vand(w196, ca);
+
+  const vec_t w3 = vxor3(w0, w1, w2);
+  return vxnor3(state[0], state[2], w3);
+}
+
+// Update state of all lanes by `bits` ( = 8 or 32 ) positions, absorbing
+// message bits `m` & returning key stream bits ( only lowest `bits` -many bits
+// of each 64 -bit lane are meaningful ); see `acorn_utils::state_update`
+template<const size_t bits>
+static inline vec_t
+state_update(vec_t* const state, // SoA state of `LANE_CNT` messages
+             const vec_t m,      // `bits` -many message bits
+             const vec_t ca,     // `bits` -many control bits `a`
+             const vec_t cb      // `bits` -many control bits `b`
+)
+  requires((bits == 8) || (bits == 32))
+{
+  const vec_t mask = vset1((1ul << bits) - 1ul);
+
+  // step 1
+  const vec_t w235 = vshr<5>(state[5]);
+  const vec_t w196 = vshr<3>(state[4]);
+  const vec_t w160 = vshr<6>(state[3]);
+  const vec_t w111 = vshr<4>(state[2]);
+  const vec_t w66 = vshr<5>(state[1]);
+  const vec_t w23 = vshr<23>(state[0]);
+
+  state[6] = vxor(state[6], vand(vxor(state[5], w235), mask));
+  state[5] = vxor(state[5], vand(vxor(state[4], w196), mask));
+  state[4] = vxor(state[4], vand(vxor(state[3], w160), mask));
+  state[3] = vxor(state[3], vand(vxor(state[2], w111), mask));
+  state[2] = vxor(state[2], vand(vxor(state[1], w66), mask));
+  state[1] = vxor(state[1], vand(vxor(state[0], w23), mask));
+  // step 2
+  const vec_t ks = ksg128(state);
+  // step 3
+  const vec_t fb = fbk128(state, ca, cb, ks);
+  // step 4
+  state[6] = vxor(state[6], vshl<4>(vand(vxor(fb, m), mask)));
+
+  constexpr int sh = static_cast<int>(bits);
+  state[0] = vor(vshr<sh>(state[0]), vshl<61 - sh>(vand(state[1], mask)));
+  state[1] = vor(vshr<sh>(state[1]), vshl<46 - sh>(vand(state[2], mask)));
+  state[2] = vor(vshr<sh>(state[2]), vshl<47 - sh>(vand(state[3], mask)));
+  state[3] = vor(vshr<sh>(state[3]), vshl<39 - sh>(vand(state[4], mask)));
+  state[4] = vor(vshr<sh>(state[4]), vshl<37 - sh>(vand(state[5], mask)));
+  state[5] = vor(vshr<sh>(state[5]), vshl<59 - sh>(vand(state[6], mask)));
+  state[6] = vshr<sh>(state[6]);
+
+  return ks;
+}
+
+// Update state of all lanes by `bits` ( = 8 or 32 ) positions, while decrypting
+// encrypted bits `m_in` & returning decrypted bits ( only lowest `bits` -many
+// bits of each 64 -bit lane are meaningful ); see decrypting variant of
+// `acorn_utils::state_update`
+template<const size_t bits>
+static inline vec_t
+state_update_dec(vec_t* const state, // SoA state of `LANE_CNT` messages
+                 const vec_t m_in,   // `bits` -many encrypted bits
+                 const vec_t ca,     // `bits` -many control bits `a`
+                 const vec_t cb      // `bits` -many control bits `b`
+)
+  requires((bits == 8) || (bits == 32))
+{
+  const vec_t mask = vset1((1ul << bits) - 1ul);
+
+  // step 1
+  const vec_t w235 = vshr<5>(state[5]);
+  const vec_t w196 = vshr<3>(state[4]);
+  const vec_t w160 = vshr<6>(state[3]);
+  const vec_t w111 = vshr<4>(state[2]);
+  const vec_t w66 = vshr<5>(state[1]);
+  const vec_t w23 = vshr<23>(state[0]);
+
+  state[6] = vxor(state[6], vand(vxor(state[5], w235), mask));
+  state[5] = vxor(state[5], vand(vxor(state[4], w196), mask));
+  state[4] = vxor(state[4], vand(vxor(state[3], w160), mask));
+  state[3] = vxor(state[3], vand(vxor(state[2], w111), mask));
+  state[2] = vxor(state[2], vand(vxor(state[1], w66), mask));
+  state[1] = vxor(state[1], vand(vxor(state[0], w23), mask));
+  // step 2
+  const vec_t ks = ksg128(state);
+  const vec_t m_out = vand(vxor(m_in, ks), mask);
+  // step 3
+  const vec_t fb = fbk128(state, ca, cb, ks);
+  // step 4
+  state[6] = vxor(state[6], vshl<4>(vand(vxor(fb, m_out), mask)));
+
+  constexpr int sh = static_cast<int>(bits);
+  state[0] = vor(vshr<sh>(state[0]), vshl<61 - sh>(vand(state[1], mask)));
+  state[1] = vor(vshr<sh>(state[1]), vshl<46 - sh>(vand(state[2], mask)));
+  state[2] = vor(vshr<sh>(state[2]), vshl<47 - sh>(vand(state[3], mask)));
+  state[3] = vor(vshr<sh>(state[3]), vshl<39 - sh>(vand(state[4], mask)));
+  state[4] = vor(vshr<sh>(state[4]), vshl<37 - sh>(vand(state[5], mask)));
+  state[5] = vor(vshr<sh>(state[5]), vshl<59 - sh>(vand(state[6], mask)));
+  state[6] = vshr<sh>(state[6]);
+
+  return m_out;
+}
+
+// Gathers big endian 32 -bit word at offset `off` of each of `LANE_CNT` byte
+// slices ( each of length `len` -bytes, placed one after another ) into a
+// vector register
+static inline vec_t
+load_words(const uint8_t* const __restrict in, // `LANE_CNT` byte slices
+           const size_t len,                   // length of each byte slice
+           const size_t off                    // read from this offset
+)
+{
+  uint64_t words[LANE_CNT];
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    const uint32_t word = acorn_utils::from_be_bytes(in + i * len + off);
+    words[i] = static_cast<uint64_t>(word);
+  }
+
+  return vload(words);
+}
+
+// Gathers byte at offset `off` of each of `LANE_CNT` byte slices ( each of
+// length `len` -bytes, placed one after another ) into a vector register
+static inline vec_t
+load_bytes(const uint8_t* const __restrict in, // `LANE_CNT` byte slices
+           const size_t len,                   // length of each byte slice
+           const size_t off                    // read from this offset
+)
+{
+  uint64_t words[LANE_CNT];
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    words[i] = static_cast<uint64_t>(in[i * len + off]);
+  }
+
+  return vload(words);
+}
+
+// Scatters lower 32 -bits of each lane of vector register, as big endian bytes,
+// to offset `off` of each of `LANE_CNT` byte slices
+static inline void
+store_words(const vec_t v,                // `LANE_CNT` words
+            const size_t len,             // length of each byte slice
+            const size_t off,             // write to this offset
+            uint8_t* const __restrict out // `LANE_CNT` byte slices
+)
+{
+  uint64_t words[LANE_CNT];
+  vstore(words, v);
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    const uint32_t word = static_cast<uint32_t>(words[i]);
+    acorn_utils::to_be_bytes(word, out + i * len + off);
+  }
+}
+
+// Scatters lowest byte of each lane of vector register, to offset `off` of
+// each of `LANE_CNT` byte slices
+static inline void
+store_bytes(const vec_t v,                // `LANE_CNT` bytes
+            const size_t len,             // length of each byte slice
+            const size_t off,             // write to this offset
+            uint8_t* const __restrict out // `LANE_CNT` byte slices
+)
+{
+  uint64_t words[LANE_CNT];
+  vstore(words, v);
+
+  for (size_t i = 0; i < LANE_CNT; i++) {
+    out[i * len + off] = static_cast<uint8_t>(words[i]);
+  }
+}
+
+// Initialize Acorn-128 state of all lanes; see `acorn_utils::initialize`
+static inline void
+initialize(vec_t* const __restrict state,       // SoA state ( ensure zeroed ! )
+           const uint8_t* const __restrict key, // `LANE_CNT` secret keys
+           const uint8_t* const __restrict iv   // `LANE_CNT` nonces
+)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+
+  vec_t words[4];
+  for (size_t i = 0; i < 4; i++) {
+    words[i] = load_words(key, 16, i << 2);
+  }
+
+  // --- step 2, 3, 4 ---
+  for (size_t i = 0; i < 4; i++) {
+    state_update<32>(state, words[i], ones, ones);
+  }
+
+  for (size_t i = 0; i < 4; i++) {
+    state_update<32>(state, load_words(iv, 16, i << 2), ones, ones);
+  }
+
+  state_update<32>(state, vxor(words[0], vset1(0b1ul)), ones, ones);
+
+  for (size_t i = 1; i < 48; i++) {
+    state_update<32>(state, words[i & 3], ones, ones);
+  }
+  // --- step 2, 3, 4 ---
+}
+
+// Appends single `1` -bit, followed by `0` -bits, after associated data bits/
+// text bits; see `acorn_utils::process_{associated_data, plain_text}`
+static inline void
+append_padding(vec_t* const state, const vec_t cb)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+  const vec_t zeros = vset1(acorn_utils::MIN_U64);
+
+  state_update<32>(state, vset1(1ul), ones, cb);
+
+  for (size_t i = 0; i < 4; i++) {
+    state_update<32>(state, zeros, ones, cb);
+  }
+
+  for (size_t i = 4; i < 8; i++) {
+    state_update<32>(state, zeros, zeros, cb);
+  }
+}
+
+// Processing associated data bytes of all lanes; see
+// `acorn_utils::process_associated_data`
+static inline void
+process_associated_data(
+  vec_t* const __restrict state,        // SoA state
+  const uint8_t* const __restrict data, // `LANE_CNT` associated data slices
+  const size_t data_len                 // len(data) of each lane, can be >= 0
+)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+
+  const size_t u32_cnt = data_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = data_len % 4;  // remaining 8 -bit chunk count
+
+  for (size_t i = 0; i < u32_cnt; i++) {
+    const vec_t word = load_words(data, data_len, i << 2);
+    state_update<32>(state, word, ones, ones);
+  }
+
+  for (size_t i = 0; i < u08_cnt; i++) {
+    const vec_t byte = load_bytes(data, data_len, (u32_cnt << 2) + i);
+    state_update<8>(state, byte, ones, ones);
+  }
+
+  append_padding(state, ones);
+}
+
+// Encrypts plain text bytes of all lanes; see
+// `acorn_utils::process_plain_text`
+static inline void
+process_plain_text(vec_t* const __restrict state,         // SoA state
+                   const uint8_t* const __restrict text,  // plain texts
+                   uint8_t* const __restrict cipher,      // cipher texts
+                   const size_t ct_len // length of each lane, can be >= 0
+)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+  const vec_t zeros = vset1(acorn_utils::MIN_U64);
+
+  const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
+
+  for (size_t i = 0; i < u32_cnt; i++) {
+    const vec_t dec = load_words(text, ct_len, i << 2);
+    const vec_t ks = state_update<32>(state, dec, ones, zeros);
+
+    store_words(vxor(dec, ks), ct_len, i << 2, cipher);
+  }
+
+  for (size_t i = 0; i < u08_cnt; i++) {
+    const size_t off = (u32_cnt << 2) + i;
+
+    const vec_t dec = load_bytes(text, ct_len, off);
+    const vec_t ks = state_update<8>(state, dec, ones, zeros);
+
+    store_bytes(vxor(dec, ks), ct_len, off, cipher);
+  }
+
+  append_padding(state, zeros);
+}
+
+// Decrypts cipher text bytes of all lanes; see
+// `acorn_utils::process_cipher_text`
+static inline void
+process_cipher_text(vec_t* const __restrict state,          // SoA state
+                    const uint8_t* const __restrict cipher, // cipher texts
+                    uint8_t* const __restrict text,         // plain texts
+                    const size_t ct_len // length of each lane, can be >= 0
+)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+  const vec_t zeros = vset1(acorn_utils::MIN_U64);
+
+  const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
+  const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
+
+  for (size_t i = 0; i < u32_cnt; i++) {
+    const vec_t enc = load_words(cipher, ct_len, i << 2);
+    const vec_t dec = state_update_dec<32>(state, enc, ones, zeros);
+
+    store_words(dec, ct_len, i << 2, text);
+  }
+
+  for (size_t i = 0; i < u08_cnt; i++) {
+    const size_t off = (u32_cnt << 2) + i;
+
+    const vec_t enc = load_bytes(cipher, ct_len, off);
+    const vec_t dec = state_update_dec<8>(state, enc, ones, zeros);
+
+    store_bytes(dec, ct_len, off, text);
+  }
+
+  append_padding(state, zeros);
+}
+
+// Finalize Acorn-128 of all lanes, generating 128 -bit authentication tag for
+// each of them; see `acorn_utils::finalize`
+static inline void
+finalize(vec_t* const __restrict state, uint8_t* const __restrict tag)
+{
+  const vec_t ones = vset1(acorn_utils::MAX_U32);
+  const vec_t zeros = vset1(acorn_utils::MIN_U64);
+
+  for (size_t i = 0; i < 20; i++) {
+    state_update<32>(state, zeros, ones, ones);
+  }
+
+  // take last 128 keystream bits & interpret it as authentication tag
+  for (size_t i = 0; i < 4; i++) {
+    const vec_t ks = state_update<32>(state, zeros, ones, ones);
+    store_words(ks, 16, i << 2, tag);
+  }
+}
+
+#else
+
+// Without SIMD support, messages are processed one at a time
+constexpr size_t LANE_CNT = 1ul;
+
+#endif
+
+}
+
+namespace acorn {
+
+// Acorn-128 authenticated encryption of `msg_cnt` -many independent messages,
+// each with `ct_len` -bytes plain text & `d_len` -bytes associated data,
+// computing same encrypted bytes & 128 -bit authentication tag, as
+// `acorn::encrypt` does for each of them
+//
+// Messages are processed `acorn_simd::LANE_CNT` at a time, with Acorn-128
+// state of each of them living in a separate lane of vector registers;
+// messages left over ( if any ) are processed one after another.
+//
+// Message `i` ( < msg_cnt ) lives at following offsets
+//
+// - secret key       : key + i * 16
+// - public nonce     : nonce + i * 16
+// - plain text       : text + i * ct_len
+// - associated data  : data + i * d_len
+// - encrypted text   : cipher + i * ct_len
+// - auth tag         : tag + i * 16
+//
+// Note, avoid nonce reuse i.e. don't use same nonce twice with same secret key
+static inline void
+batch_encrypt(const uint8_t* const __restrict key,   // secret keys
+              const uint8_t* const __restrict nonce, // message nonces
+              const uint8_t* const __restrict text,  // plain texts
+              const size_t ct_len,                   // len(text), len(cipher)
+              const uint8_t* const __restrict data,  // associated data
+              const size_t d_len,                    // len(data)
+              uint8_t* const __restrict cipher,      // encrypted texts
+              uint8_t* const __restrict tag,         // authentication tags
+              const size_t msg_cnt                   // # -of messages
+)
+{
+#if defined(__AVX512F__) || defined(__AVX2__)
+  constexpr size_t lanes = acorn_simd::LANE_CNT;
+  const size_t simd_cnt = msg_cnt - (msg_cnt % lanes);
+
+  for (size_t i = 0; i < simd_cnt; i += lanes) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * ct_len;
+    const size_t d_off = i * d_len;
+
+    // 293 -bit Acorn-128 state of each lane, zero initialize
+    acorn_simd::vec_t state[acorn_utils::LFSR_CNT];
+    for (size_t j = 0; j < acorn_utils::LFSR_CNT; j++) {
+      state[j] = acorn_simd::vset1(0ul);
+    }
+
+    acorn_simd::initialize(state, key + knt_off, nonce + knt_off);
+    acorn_simd::process_associated_data(state, data + d_off, d_len);
+    acorn_simd::process_plain_text(
+      state, text + ct_off, cipher + ct_off, ct_len);
+    acorn_simd::finalize(state, tag + knt_off);
+  }
+#else
+  constexpr size_t simd_cnt = 0ul;
+#endif
+
+  // messages left over, processed one after another
+  for (size_t i = simd_cnt; i < msg_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * ct_len;
+    const size_t d_off = i * d_len;
+
+    encrypt(key + knt_off,
+            nonce + knt_off,
+            text + ct_off,
+            ct_len,
+            data + d_off,
+            d_len,
+            cipher + ct_off,
+            tag + knt_off);
+  }
+}
+
+// Acorn-128 verified decryption of `msg_cnt` -many independent messages, each
+// with `ct_len` -bytes encrypted text & `d_len` -bytes associated data,
+// computing same decrypted bytes & verification flag, as `acorn::decrypt` does
+// for each of them
+//
+// Memory layout is same as described on top of `batch_encrypt`, while `i` -th
+// verification flag is written to `flag[i]`.
+//
+// Always ensure `assert flag[i]`, before consuming `i` -th decrypted text !
+static inline void
+batch_decrypt(const uint8_t* const __restrict key,    // secret keys
+              const uint8_t* const __restrict nonce,  // message nonces
+              const uint8_t* const __restrict tag,    // authentication tags
+              const uint8_t* const __restrict cipher, // encrypted texts
+              const size_t ct_len,                    // len(cipher), len(text)
+              const uint8_t* const __restrict data,   // associated data
+              const size_t d_len,                     // len(data)
+              uint8_t* const __restrict text,         // decrypted texts
+              bool* const __restrict flag,            // verification flags
+              const size_t msg_cnt                    // # -of messages
+)
+{
+#if defined(__AVX512F__) || defined(__AVX2__)
+  constexpr size_t lanes = acorn_simd::LANE_CNT;
+  const size_t simd_cnt = msg_cnt - (msg_cnt % lanes);
+
+  for (size_t i = 0; i < simd_cnt; i += lanes) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * ct_len;
+    const size_t d_off = i * d_len;
+
+    // 293 -bit Acorn-128 state of each lane, zero initialize
+    acorn_simd::vec_t state[acorn_utils::LFSR_CNT];
+    for (size_t j = 0; j < acorn_utils::LFSR_CNT; j++) {
+      state[j] = acorn_simd::vset1(0ul);
+    }
+    // 128 -bit authentication tag of each lane
+    uint8_t tag_[lanes << 4];
+
+    acorn_simd::initialize(state, key + knt_off, nonce + knt_off);
+    acorn_simd::process_associated_data(state, data + d_off, d_len);
+    acorn_simd::process_cipher_text(
+      state, cipher + ct_off, text + ct_off, ct_len);
+    acorn_simd::finalize(state, tag_);
+
+    for (size_t j = 0; j < lanes; j++) {
+      const size_t off = j << 4;
+
+      bool fail = false;
+      for (size_t k = 0; k < 16; k++) {
+        fail |= static_cast<bool>(tag[knt_off + off + k] ^ tag_[off + k]);
+      }
+      flag[i + j] = !fail;
+    }
+  }
+#else
+  constexpr size_t simd_cnt = 0ul;
+#endif
+
+  // messages left over, processed one after another
+  for (size_t i = simd_cnt; i < msg_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * ct_len;
+    const size_t d_off = i * d_len;
+
+    flag[i] = decrypt(key + knt_off,
+                      nonce + knt_off,
+                      tag + knt_off,
+                      cipher + ct_off,
+                      ct_len,
+                      data + d_off,
+                      d_len,
+                      text + ct_off);
+  }
+}
+
+}
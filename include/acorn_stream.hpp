@@ -0,0 +1,365 @@
+#pragma once
+#include "acorn_utils.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ), consuming associated data & plain/ cipher text bytes
+// in arbitrary-length chunks, as they arrive
+//
+// Produced encrypted/ decrypted bytes & authentication tag are same as what
+// `acorn::{encrypt, decrypt}` compute, given concatenation of all chunks.
+namespace acorn_stream {
+
+// Streaming context moves through these phases, in order
+enum class phase_t : uint8_t
+{
+  associated_data, // absorbing associated data bytes
+  text,            // encrypting/ decrypting text bytes
+  finalized        // authentication tag computed, nothing more to do
+};
+
+// Acorn-128 state along with partially filled 32 -bit word, carried over from
+// previous chunk
+//
+// One-shot routines ( see `acorn_utils::process_*` ) update state 32 -bits at
+// a time, only last `len % 4` bytes are consumed using 8 -bit updates. Updates
+// of different width are not interchangeable ( i.e. two 8 -bit updates don't
+// produce same state as single 16 -bit update ), so bytes which don't yet form
+// a complete 32 -bit word are held back in `buf`, until either next chunk
+// completes the word or current phase ends.
+struct ctx_t
+{
+  uint64_t state[acorn_utils::LFSR_CNT]; // 293 -bit Acorn-128 state
+  uint8_t buf[4];                        // partial big endian 32 -bit word
+  size_t buf_len;                        // # -of bytes in `buf`, < 4
+  phase_t phase;                         // current phase of context
+};
+
+// Initialize streaming context, using 128 -bit secret key & 128 -bit public
+// message nonce; see section 1.3.3 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline void
+initialize(ctx_t& ctx,
+           const uint8_t* const __restrict key,  // 128 -bit secret key
+           const uint8_t* const __restrict nonce // 128 -bit message nonce
+)
+{
+  std::fill_n(ctx.state, acorn_utils::LFSR_CNT, 0ul);
+  ctx.buf_len = 0;
+  ctx.phase = phase_t::associated_data;
+
+  acorn_utils::initialize(ctx.state, key, nonce);
+}
+
+// Encrypts/ decrypts ( choose using template parameter ) single big endian 32
+// -bit word, read from `in` & written to `out`; see section 1.3.5 of Acorn
+// specification https://competitions.cr.yp.to/round3/acornv3.pdf
+template<const bool encrypt>
+static inline void
+process_word(uint64_t* const __restrict state,   // 293 -bit state
+             const uint8_t* const __restrict in, // 4 input bytes
+             uint8_t* const __restrict out       // 4 output bytes
+)
+{
+  using namespace acorn_utils;
+
+  const uint32_t word = from_be_bytes(in);
+
+  if constexpr (encrypt) {
+    const uint32_t ks = state_update<32>(state, word, MAX_U32, MIN_U32);
+    to_be_bytes(word ^ ks, out);
+  } else {
+    uint32_t dec = 0;
+    state_update<32>(state, word, &dec, MAX_U32, MIN_U32);
+    to_be_bytes(dec, out);
+  }
+}
+
+// Encrypts/ decrypts ( choose using template parameter ) single byte; see
+// section 1.3.5 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+template<const bool encrypt>
+static inline uint8_t
+process_byte(uint64_t* const state, // 293 -bit state
+             const uint8_t in       // input byte
+)
+{
+  using namespace acorn_utils;
+
+  if constexpr (encrypt) {
+    return in ^ state_update<8>(state, in, MAX_U8, MIN_U8);
+  } else {
+    uint8_t dec = 0;
+    state_update<8>(state, in, &dec, MAX_U8, MIN_U8);
+    return dec;
+  }
+}
+
+// Absorbs a chunk of associated data bytes, holding back trailing bytes which
+// don't form a complete 32 -bit word; see section 1.3.4 of Acorn
+// specification https://competitions.cr.yp.to/round3/acornv3.pdf
+static inline void
+absorb_data(ctx_t& ctx,
+            const uint8_t* const __restrict data, // associated data chunk
+            const size_t d_len                    // len(data), can be >= 0
+)
+{
+  using namespace acorn_utils;
+
+  assert(ctx.phase == phase_t::associated_data);
+
+  size_t off = 0;
+
+  // complete partial word, carried over from previous chunk
+  if (ctx.buf_len > 0) {
+    const size_t n = std::min(4 - ctx.buf_len, d_len);
+    std::memcpy(ctx.buf + ctx.buf_len, data, n);
+
+    ctx.buf_len += n;
+    off = n;
+
+    if (ctx.buf_len < 4) {
+      return;
+    }
+
+    state_update<32>(ctx.state, from_be_bytes(ctx.buf), MAX_U32, MAX_U32);
+    ctx.buf_len = 0;
+  }
+
+  const size_t u32_cnt = (d_len - off) >> 2; // 32 -bit chunk count
+
+  for (size_t i = 0; i < u32_cnt; i++) {
+    const uint32_t word = from_be_bytes(data + off + (i << 2));
+    state_update<32>(ctx.state, word, MAX_U32, MAX_U32);
+  }
+
+  off += u32_cnt << 2;
+
+  // hold back trailing bytes, until next chunk
+  ctx.buf_len = d_len - off;
+  std::memcpy(ctx.buf, data + off, ctx.buf_len);
+}
+
+// Ends associated data phase ( if not already ended ), by consuming held back
+// bytes using 8 -bit updates & appending padding bits
+static inline void
+finish_data(ctx_t& ctx)
+{
+  using namespace acorn_utils;
+
+  if (ctx.phase != phase_t::associated_data) {
+    return;
+  }
+
+  for (size_t i = 0; i < ctx.buf_len; i++) {
+    state_update<8>(ctx.state, ctx.buf[i], MAX_U8, MAX_U8);
+  }
+
+  append_padding<MAX_U32>(ctx.state);
+
+  ctx.buf_len = 0;
+  ctx.phase = phase_t::text;
+}
+
+// Encrypts/ decrypts ( choose using template parameter ) a chunk of text
+// bytes, returning how many bytes are written to `out`
+//
+// Trailing input bytes which don't form a complete 32 -bit word are held back
+// ( i.e. not written to `out` ) until next chunk completes the word or
+// `finish_text` is invoked, so returned length is a multiple of 4 & may
+// differ from `len` by at most 3 bytes in either direction. Ensure `out` has
+// room for `len + 3` bytes.
+template<const bool encrypt>
+static inline size_t
+process_text(ctx_t& ctx,
+             const uint8_t* const __restrict in, // input chunk
+             const size_t len,                   // len(in), can be >= 0
+             uint8_t* const __restrict out       // output bytes
+)
+{
+  finish_data(ctx);
+  assert(ctx.phase == phase_t::text);
+
+  size_t off = 0;
+  size_t written = 0;
+
+  // complete partial word, carried over from previous chunk
+  if (ctx.buf_len > 0) {
+    const size_t n = std::min(4 - ctx.buf_len, len);
+    std::memcpy(ctx.buf + ctx.buf_len, in, n);
+
+    ctx.buf_len += n;
+    off = n;
+
+    if (ctx.buf_len < 4) {
+      return 0;
+    }
+
+    process_word<encrypt>(ctx.state, ctx.buf, out);
+    ctx.buf_len = 0;
+    written = 4;
+  }
+
+  const size_t u32_cnt = (len - off) >> 2; // 32 -bit chunk count
+
+  for (size_t i = 0; i < u32_cnt; i++) {
+    const size_t i4 = i << 2;
+    process_word<encrypt>(ctx.state, in + off + i4, out + written + i4);
+  }
+
+  off += u32_cnt << 2;
+  written += u32_cnt << 2;
+
+  // hold back trailing bytes, until next chunk
+  ctx.buf_len = len - off;
+  std::memcpy(ctx.buf, in + off, ctx.buf_len);
+
+  return written;
+}
+
+// Ends text phase, by encrypting/ decrypting ( choose using template parameter
+// ) held back bytes using 8 -bit updates & appending padding bits, returning
+// how many bytes ( < 4 ) are written to `out`
+template<const bool encrypt>
+static inline size_t
+finish_text(ctx_t& ctx, uint8_t* const __restrict out)
+{
+  finish_data(ctx);
+  assert(ctx.phase == phase_t::text);
+
+  const size_t written = ctx.buf_len;
+
+  for (size_t i = 0; i < written; i++) {
+    out[i] = process_byte<encrypt>(ctx.state, ctx.buf[i]);
+  }
+
+  acorn_utils::append_padding<acorn_utils::MIN_U32>(ctx.state);
+
+  ctx.buf_len = 0;
+  ctx.phase = phase_t::finalized;
+
+  return written;
+}
+
+}
+
+namespace acorn {
+
+// Acorn-128 authenticated encryption, consuming associated data & plain text
+// in arbitrary-length chunks, as they arrive
+//
+// Invoke `absorb_data` zero or more times, followed by `encrypt_update` zero
+// or more times & finally `finalize` exactly once. Concatenation of all bytes
+// written by `encrypt_update` & `finalize` is same as encrypted bytes computed
+// by `acorn::encrypt`, when invoked on concatenated associated data/ plain text
+// chunks; so is the authentication tag.
+//
+// Note, avoid nonce reuse i.e. don't use same nonce twice with same secret key
+class encryptor
+{
+public:
+  encryptor(const uint8_t* const __restrict key,  // 128 -bit secret key
+            const uint8_t* const __restrict nonce // 128 -bit message nonce
+  )
+  {
+    acorn_stream::initialize(ctx, key, nonce);
+  }
+
+  // Absorbs next chunk of associated data bytes; must not be invoked after
+  // `encrypt_update`/ `finalize`
+  void absorb_data(const uint8_t* const __restrict data, const size_t d_len)
+  {
+    acorn_stream::absorb_data(ctx, data, d_len);
+  }
+
+  // Encrypts next chunk of plain text bytes, returning how many encrypted
+  // bytes are written to `cipher`, which must have room for `ct_len + 3`
+  // bytes; see `acorn_stream::process_text`
+  size_t encrypt_update(const uint8_t* const __restrict text,
+                        const size_t ct_len,
+                        uint8_t* const __restrict cipher)
+  {
+    return acorn_stream::process_text<true>(ctx, text, ct_len, cipher);
+  }
+
+  // Writes remaining ( < 4 ) encrypted bytes to `cipher`, returning how many
+  // of them are written, and computes 128 -bit authentication tag
+  size_t finalize(uint8_t* const __restrict cipher,
+                  uint8_t* const __restrict tag)
+  {
+    const size_t written = acorn_stream::finish_text<true>(ctx, cipher);
+    acorn_utils::finalize(ctx.state, tag);
+    return written;
+  }
+
+private:
+  acorn_stream::ctx_t ctx;
+};
+
+// Acorn-128 verified decryption, consuming associated data & cipher text in
+// arbitrary-length chunks, as they arrive
+//
+// Invoke `absorb_data` zero or more times, followed by `decrypt_update` zero
+// or more times & finally `finalize` exactly once. Concatenation of all bytes
+// written by `decrypt_update` & `finalize` is same as decrypted bytes computed
+// by `acorn::decrypt`, when invoked on concatenated associated data/ cipher
+// text chunks; so is the verification flag.
+//
+// Note, decrypted bytes are released before authentication tag can be
+// verified, don't act on them until `finalize` returns truth value !
+class decryptor
+{
+public:
+  decryptor(const uint8_t* const __restrict key,  // 128 -bit secret key
+            const uint8_t* const __restrict nonce // 128 -bit message nonce
+  )
+  {
+    acorn_stream::initialize(ctx, key, nonce);
+  }
+
+  // Absorbs next chunk of associated data bytes; must not be invoked after
+  // `decrypt_update`/ `finalize`
+  void absorb_data(const uint8_t* const __restrict data, const size_t d_len)
+  {
+    acorn_stream::absorb_data(ctx, data, d_len);
+  }
+
+  // Decrypts next chunk of cipher text bytes, returning how many decrypted
+  // bytes are written to `text`, which must have room for `ct_len + 3` bytes;
+  // see `acorn_stream::process_text`
+  size_t decrypt_update(const uint8_t* const __restrict cipher,
+                        const size_t ct_len,
+                        uint8_t* const __restrict text)
+  {
+    return acorn_stream::process_text<false>(ctx, cipher, ct_len, text);
+  }
+
+  // Writes remaining decrypted bytes ( total cipher text length % 4 of them )
+  // to `text`, setting `written` to how many of them are written, & verifies
+  // 128 -bit authentication tag, returning boolean verification flag
+  bool finalize(const uint8_t* const __restrict tag,
+                uint8_t* const __restrict text,
+                size_t& written)
+  {
+    // 128 -bit authentication tag
+    uint8_t tag_[16];
+
+    written = acorn_stream::finish_text<false>(ctx, text);
+    acorn_utils::finalize(ctx.state, tag_);
+
+    // verification flag
+    bool fail = false;
+    // compare authentication tag byte-by-byte
+    for (size_t i = 0; i < 16; i++) {
+      fail |= static_cast<bool>(tag[i] ^ tag_[i]);
+    }
+    return !fail;
+  }
+
+private:
+  acorn_stream::ctx_t ctx;
+};
+
+}
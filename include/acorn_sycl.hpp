@@ -0,0 +1,175 @@
+#pragma once
+#include "acorn.hpp"
+#include <CL/sycl.hpp>
+
+// Acorn-128: A lightweight authenticated cipher ( read Authenticated Encryption
+// with Associated Data ) targeting data-parallel SYCL devices ( say multi-core
+// CPU, exposed via OpenCL/ Level Zero ), using SYCL/ DPC++
+//
+// Kernels of `acorn_fpga::` namespace are single work-item loops, which are
+// meant to be pipelined by FPGA compiler, but on a CPU device they'd occupy
+// only one core. Kernels of this namespace launch one work-item per message,
+// over an ND-range, so that all compute units of device are kept busy.
+namespace acorn_sycl {
+
+// To avoid kernel name mangling in optimization report
+class kernelAcorn128EncryptNDRange;
+class kernelAcorn128DecryptNDRange;
+
+// Rounds `invk_cnt` up to next multiple of work-group size, so that it can be
+// used as global range of ND-range kernel
+static inline size_t
+global_range(const size_t invk_cnt, const size_t wg_size)
+{
+  return ((invk_cnt + wg_size - 1) / wg_size) * wg_size;
+}
+
+// Acorn-128 authenticated encryption, as data-parallel SYCL kernel, where each
+// work-item invokes `acorn::encrypt` on one message
+//
+// Arguments are laid out same as `acorn_fpga::encrypt`, except `wg_size`,
+// denoting # -of work-items per work-group; global range is rounded up to a
+// multiple of `wg_size`, where excess work-items do nothing.
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+encrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict text,  // plain text
+  const size_t text_len,                 // text_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict enc,         // encrypted data bytes
+  const size_t enc_len,                  // = text_len
+  uint8_t* const __restrict tag,         // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const size_t invk_cnt,                 // # -of messages i.e. work-items
+  const size_t wg_size,                  // work-group size
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(text_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(text_len == enc_len);
+  assert(wg_size > 0);
+
+  const size_t per_invk_ct_len = text_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  sycl::range<1> glb{ global_range(invk_cnt, wg_size) };
+  sycl::range<1> loc{ wg_size };
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.parallel_for<kernelAcorn128EncryptNDRange>(
+      sycl::nd_range<1>{ glb, loc },
+      [=](sycl::nd_item<1> it) [[intel::kernel_args_restrict]] {
+        const size_t i = it.get_global_id(0);
+        if (i >= invk_cnt) {
+          return;
+        }
+
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        acorn::encrypt(key + knt_off,
+                       nonce + knt_off,
+                       text + ct_off,
+                       per_invk_ct_len,
+                       data + add_off,
+                       per_invk_dt_len,
+                       enc + ct_off,
+                       tag + knt_off);
+      });
+  });
+  return evt;
+}
+
+// Acorn-128 verified decryption, as data-parallel SYCL kernel, where each
+// work-item invokes `acorn::decrypt` on one message & writes its verification
+// flag
+//
+// Arguments are laid out same as `acorn_fpga::decrypt`, except `wg_size`,
+// denoting # -of work-items per work-group; global range is rounded up to a
+// multiple of `wg_size`, where excess work-items do nothing.
+//
+// After transferring output data back to host, first verification flags need to
+// be tested for truth value, if it doesn't pass, something is off, as message
+// authenticity can't be ensured !
+//
+// Note, in function signature all data lengths are in terms of `bytes` !
+static inline sycl::event
+decrypt(
+  sycl::queue& q,                        // SYCL job submission queue
+  const uint8_t* const __restrict key,   // secret keys
+  const size_t key_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict nonce, // public nonces
+  const size_t nonce_len,                // = invk_cnt * 16
+  const uint8_t* const __restrict tag,   // authentication tags
+  const size_t tag_len,                  // = invk_cnt * 16
+  const uint8_t* const __restrict enc,   // encrypted data bytes
+  const size_t enc_len,                  // enc_len % invk_cnt == 0
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // data_len % invk_cnt == 0
+  uint8_t* const __restrict text,        // plain text bytes
+  const size_t text_len,                 // = enc_len
+  bool* const __restrict flag,           // verification flags
+  const size_t flag_len,                 // invk_cnt * sizeof(bool)
+  const size_t invk_cnt,                 // # -of messages i.e. work-items
+  const size_t wg_size,                  // work-group size
+  const std::vector<sycl::event> evts    // forms SYCL runtime dependency graph
+)
+{
+  assert(invk_cnt << 4 == key_len);
+  assert(invk_cnt << 4 == nonce_len);
+  assert(invk_cnt << 4 == tag_len);
+  assert(enc_len % invk_cnt == 0);
+  assert(data_len % invk_cnt == 0);
+  assert(enc_len == text_len);
+  assert(invk_cnt * sizeof(bool) == flag_len);
+  assert(wg_size > 0);
+
+  const size_t per_invk_ct_len = enc_len / invk_cnt;
+  const size_t per_invk_dt_len = data_len / invk_cnt;
+
+  sycl::range<1> glb{ global_range(invk_cnt, wg_size) };
+  sycl::range<1> loc{ wg_size };
+
+  sycl::event evt = q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.parallel_for<kernelAcorn128DecryptNDRange>(
+      sycl::nd_range<1>{ glb, loc },
+      [=](sycl::nd_item<1> it) [[intel::kernel_args_restrict]] {
+        const size_t i = it.get_global_id(0);
+        if (i >= invk_cnt) {
+          return;
+        }
+
+        const size_t knt_off = i << 4;
+        const size_t ct_off = i * per_invk_ct_len;
+        const size_t add_off = i * per_invk_dt_len;
+
+        const bool flg = acorn::decrypt(key + knt_off,
+                                        nonce + knt_off,
+                                        tag + knt_off,
+                                        enc + ct_off,
+                                        per_invk_ct_len,
+                                        data + add_off,
+                                        per_invk_dt_len,
+                                        text + ct_off);
+
+        flag[i] = flg;
+      });
+  });
+  return evt;
+}
+
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <CL/sycl.hpp>
+#include <bit>
+#include <cassert>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Reusable, size-classed pool of SYCL USM allocations, so that repeated batch
+// submissions needn't pay for `sycl::malloc_{device,host}` & `sycl::free` on
+// every call, which dominates latency of small batches
+namespace acorn_usm {
+
+// Smallest size class is 2 ^ 6 = 64 bytes; every request is rounded up to next
+// power of 2, which is its size class
+constexpr size_t MIN_CLASS = 6ul;
+
+// Largest size class is 2 ^ 40 bytes, way more than any device memory we'd see
+constexpr size_t MAX_CLASS = 40ul;
+
+// Size class of an allocation request of `bytes` -many bytes
+static inline size_t
+size_class(const size_t bytes)
+{
+  const size_t cls = static_cast<size_t>(std::bit_width(bytes - (bytes > 0)));
+  return cls < MIN_CLASS ? MIN_CLASS : cls;
+}
+
+// Counters, describing how well pool is serving allocation requests
+struct stats_t
+{
+  size_t hits;     // requests served from cached buffers
+  size_t misses;   // requests which needed fresh USM allocation
+  size_t in_use;   // buffers handed out, not yet released
+  size_t cached;   // buffers sitting in free lists
+  size_t capacity; // total bytes allocated from SYCL runtime, held by pool
+};
+
+// Pool of USM allocations of one kind ( say device or host ), bound to a SYCL
+// queue; buffers are never returned to SYCL runtime until `trim` is called or
+// pool is destroyed
+//
+// All member functions are safe to be called from multiple host threads.
+class pool_t
+{
+public:
+  pool_t(sycl::queue& q_, const sycl::usm::alloc kind_)
+    : q(q_)
+    , kind(kind_)
+    , free_lists(MAX_CLASS + 1)
+    , st{}
+  {
+    assert(kind == sycl::usm::alloc::device ||
+           kind == sycl::usm::alloc::host ||
+           kind == sycl::usm::alloc::shared);
+  }
+
+  pool_t(const pool_t&) = delete;
+  pool_t& operator=(const pool_t&) = delete;
+
+  ~pool_t()
+  {
+    // buffers still in use are caller's responsibility
+    assert(st.in_use == 0);
+    trim();
+  }
+
+  // Returns USM buffer of at least `bytes` -many bytes, reusing a previously
+  // released buffer of same size class, if one is available
+  void* acquire(const size_t bytes)
+  {
+    const size_t cls = size_class(bytes);
+    assert(cls <= MAX_CLASS);
+
+    std::lock_guard<std::mutex> lock{ mtx };
+
+    std::vector<void*>& lst = free_lists[cls];
+    void* ptr = nullptr;
+
+    if (!lst.empty()) {
+      ptr = lst.back();
+      lst.pop_back();
+
+      st.hits++;
+      st.cached--;
+    } else {
+      ptr = sycl::malloc(1ul << cls, q, kind);
+      assert(ptr != nullptr);
+      owner[ptr] = cls;
+
+      st.misses++;
+      st.capacity += 1ul << cls;
+    }
+
+    st.in_use++;
+    return ptr;
+  }
+
+  // Typed variant of `acquire`, returning buffer of `cnt` -many elements
+  template<typename T>
+  T* acquire(const size_t cnt)
+  {
+    return static_cast<T*>(acquire(cnt * sizeof(T)));
+  }
+
+  // Hands buffer, previously obtained using `acquire`, back to pool, so that
+  // it can be reused by a later request of same size class
+  //
+  // Ensure no SYCL command, touching this buffer, is still in flight !
+  void release(void* ptr)
+  {
+    std::lock_guard<std::mutex> lock{ mtx };
+
+    auto it = owner.find(ptr);
+    assert(it != owner.end());
+
+    free_lists[it->second].push_back(ptr);
+
+    st.in_use--;
+    st.cached++;
+  }
+
+  // Returns all cached ( i.e. released ) buffers to SYCL runtime
+  void trim()
+  {
+    std::lock_guard<std::mutex> lock{ mtx };
+
+    for (size_t cls = 0; cls <= MAX_CLASS; cls++) {
+      for (void* ptr : free_lists[cls]) {
+        // forget buffer before freeing it, so its address is never used after
+        owner.erase(ptr);
+        sycl::free(ptr, q);
+
+        st.capacity -= 1ul << cls;
+      }
+      free_lists[cls].clear();
+    }
+
+    st.cached = 0;
+  }
+
+  // Snapshot of pool counters
+  stats_t stats()
+  {
+    std::lock_guard<std::mutex> lock{ mtx };
+    return st;
+  }
+
+  // Kind of USM allocations served by this pool
+  sycl::usm::alloc alloc_kind() const { return kind; }
+
+private:
+  sycl::queue& q;
+  const sycl::usm::alloc kind;
+  std::mutex mtx;
+  std::vector<std::vector<void*>> free_lists; // indexed by size class
+  std::unordered_map<void*, size_t> owner;    // buffer -> its size class
+  stats_t st;
+};
+
+// Allocates USM buffer of `cnt` -many elements, either from pool ( if given )
+// or directly from SYCL runtime, as `sycl::malloc_device` would
+template<typename T>
+static inline T*
+malloc_device(const size_t cnt, sycl::queue& q, pool_t* const pool)
+{
+  if (pool != nullptr) {
+    assert(pool->alloc_kind() == sycl::usm::alloc::device);
+    return pool->acquire<T>(cnt);
+  }
+  return static_cast<T*>(sycl::malloc_device(cnt * sizeof(T), q));
+}
+
+// Allocates USM host ( i.e. pinned ) buffer of `cnt` -many elements, either
+// from pool ( if given ) or directly from SYCL runtime, as `sycl::malloc_host`
+// would; host -> device & device -> host copies from/ to such buffers skip
+// staging through an intermediate pinned bounce buffer
+template<typename T>
+static inline T*
+malloc_host(const size_t cnt, sycl::queue& q, pool_t* const pool)
+{
+  if (pool != nullptr) {
+    assert(pool->alloc_kind() == sycl::usm::alloc::host);
+    return pool->acquire<T>(cnt);
+  }
+  return static_cast<T*>(sycl::malloc_host(cnt * sizeof(T), q));
+}
+
+// Whether `ptr` points to USM host/ shared memory, which kernels, submitted to
+// given queue, can access directly ( i.e. zero-copy ), without first copying
+// it to device memory
+static inline bool
+host_accessible(const void* ptr, sycl::queue& q)
+{
+  const sycl::usm::alloc kind = sycl::get_pointer_type(ptr, q.get_context());
+  return kind == sycl::usm::alloc::host || kind == sycl::usm::alloc::shared;
+}
+
+// Releases USM buffer, obtained using `acorn_usm::malloc_{device,host}`, back
+// to wherever it came from
+static inline void
+free(void* ptr, sycl::queue& q, pool_t* const pool)
+{
+  if (pool != nullptr) {
+    pool->release(ptr);
+  } else {
+    sycl::free(ptr, q);
+  }
+}
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <type_traits>
 
 using size_t = std::size_t;
 
@@ -31,6 +32,26 @@ constexpr uint32_t MAX_U32 = 0xffffffffu;
 // Minimum number which can be represented using 32 -bit unsigned interger
 constexpr uint32_t MIN_U32 = 0u;
 
+// Maximum number which can be represented using 64 -bit unsigned interger
+constexpr uint64_t MAX_U64 = 0xfffffffffffffffful;
+// Minimum number which can be represented using 64 -bit unsigned interger
+constexpr uint64_t MIN_U64 = 0ul;
+
+// Compile-time check that Acorn-128 state can be updated by `bits` -many
+// positions, in a single invocation of `state_update` ( see below ); only 8
+// -bit ( per byte tails ) & 32 -bit ( per word bodies ) steps exist
+template<const size_t bits>
+static inline constexpr bool
+check_bits()
+{
+  return (bits == 8) || (bits == 32);
+}
+
+// Unsigned integer type, which is used for holding `bits` -many message bits/
+// control bits/ key stream bits, while updating Acorn-128 state
+template<const size_t bits>
+using uint_t = std::conditional_t<bits == 8, uint8_t, uint32_t>;
+
 // Given an array of four big endian bytes this function interprets them as a
 // 32 -bit unsigned integer
 static inline uint32_t
@@ -88,14 +109,16 @@ ksg128(
   return static_cast<uint32_t>(w12 ^ state[3] ^ w0 ^ w1);
 }
 
-// Compute 32 feedback bits, using algorithm written in section 1.3.2 of Acorn
-// specification https://competitions.cr.yp.to/round3/acornv3.pdf
-static inline uint32_t
+// Compute `bits` -many feedback bits, using algorithm written in section 1.3.2
+// of Acorn specification https://competitions.cr.yp.to/round3/acornv3.pdf
+template<const size_t bits>
+static inline uint_t<bits>
 fbk128(const uint64_t* const state, // 293 -bit state register
-       const uint32_t ca,           // 32 control bits `a`
-       const uint32_t cb,           // 32 control bits `b`
-       const uint32_t ks // 32 key stream bits generated using `ksg128`
+       const uint_t<bits> ca,       // `bits` -many control bits `a`
+       const uint_t<bits> cb,       // `bits` -many control bits `b`
+       const uint_t<bits> ks // `bits` -many key stream bits, see `ksg128`
 )
+  requires(bits <= 32)
 {
   const uint64_t w244 = state[5] >> 14;
   const uint64_t w23 = state[0] >> 23;
@@ -107,44 +130,19 @@ fbk128(const uint64_t* const state, // 293 -bit state register
   const uint64_t w2 = w196 & static_cast<uint64_t>(ca);
 
   const uint64_t w3 = w0 ^ w1 ^ w2;
-  return static_cast<uint32_t>(state[0] ^ ~state[2] ^ w3);
+  return static_cast<uint_t<bits>>(state[0] ^ ~state[2] ^ w3);
 }
 
-// Compute 8 feedback bits, using algorithm written in section 1.3.2 of Acorn
-// specification https://competitions.cr.yp.to/round3/acornv3.pdf
-static inline uint8_t
-fbk128(const uint64_t* const state, // 293 -bit state register
-       const uint8_t ca,            // 8 control bits `a`
-       const uint8_t cb,            // 8 control bits `b`
-       const uint8_t ks // 8 key stream bits generated using `ksg128`
-)
+// Step 1 of state update function, defined in section 1.3.2 of Acorn
+// specification https://competitions.cr.yp.to/round3/acornv3.pdf, updating
+// `bits` -many lowest positions of six LFSRs, at once
+template<const size_t bits>
+static inline void
+update_lfsrs(uint64_t* const state) // 293 -bit state
+  requires(bits <= 32)
 {
-  const uint64_t w244 = state[5] >> 14;
-  const uint64_t w23 = state[0] >> 23;
-  const uint64_t w160 = state[3] >> 6;
-  const uint64_t w196 = state[4] >> 3;
+  constexpr uint64_t mask = (1ul << bits) - 1ul;
 
-  const uint64_t w0 = maj(w244, w23, w160);
-  const uint64_t w1 = static_cast<uint64_t>(cb & ks);
-  const uint64_t w2 = w196 & static_cast<uint64_t>(ca);
-
-  const uint64_t w3 = w0 ^ w1 ^ w2;
-  return static_cast<uint8_t>(state[0] ^ ~state[2] ^ w3);
-}
-
-// Update state function operating on 32 -bits at a time, using algorithm
-// written in section 1.3.2 of Acorn specification
-// https://competitions.cr.yp.to/round3/acornv3.pdf
-//
-// Note, if you're attempting to decrypt text back, don't use this function for
-// state updation, see below.
-static inline uint32_t
-state_update_128(uint64_t* const state, // 293 -bit state
-                 const uint32_t m,      // 32 message bits
-                 const uint32_t ca,     // 32 control bits `a`
-                 const uint32_t cb      // 32 control bits `b`
-)
-{
   const uint64_t w235 = state[5] >> 5;
   const uint64_t w196 = state[4] >> 3;
   const uint64_t w160 = state[3] >> 6;
@@ -152,171 +150,156 @@ state_update_128(uint64_t* const state, // 293 -bit state
   const uint64_t w66 = state[1] >> 5;
   const uint64_t w23 = state[0] >> 23;
 
-  // step 1
-  state[6] ^= (state[5] ^ w235) & MAX_U32;
-  state[5] ^= (state[4] ^ w196) & MAX_U32;
-  state[4] ^= (state[3] ^ w160) & MAX_U32;
-  state[3] ^= (state[2] ^ w111) & MAX_U32;
-  state[2] ^= (state[1] ^ w66) & MAX_U32;
-  state[1] ^= (state[0] ^ w23) & MAX_U32;
-  // step 2
-  const uint32_t ks = ksg128(state); // 32 key stream bits
-  // step 3
-  const uint32_t fb = fbk128(state, ca, cb, ks); // 32 feedback bits
-  // step 4
-  state[6] ^= (static_cast<uint64_t>(fb ^ m) << 4);
-  state[0] = (state[0] >> 32) | ((state[1] & MAX_U32) << 29); // 61 - 32
-  state[1] = (state[1] >> 32) | ((state[2] & MAX_U32) << 14); // 46 - 32
-  state[2] = (state[2] >> 32) | ((state[3] & MAX_U32) << 15); // 47 - 32
-  state[3] = (state[3] >> 32) | ((state[4] & MAX_U32) << 7);  // 39 - 32
-  state[4] = (state[4] >> 32) | ((state[5] & MAX_U32) << 5);  // 37 - 32
-  state[5] = (state[5] >> 32) | ((state[6] & MAX_U32) << 27); // 59 - 32
-  state[6] = state[6] >> 32;
+  state[6] ^= (state[5] ^ w235) & mask;
+  state[5] ^= (state[4] ^ w196) & mask;
+  state[4] ^= (state[3] ^ w160) & mask;
+  state[3] ^= (state[2] ^ w111) & mask;
+  state[2] ^= (state[1] ^ w66) & mask;
+  state[1] ^= (state[0] ^ w23) & mask;
+}
 
-  return ks;
+// Step 4 of state update function, defined in section 1.3.2 of Acorn
+// specification https://competitions.cr.yp.to/round3/acornv3.pdf, shifting
+// whole state register by `bits` -many positions, while feeding `fb` ( i.e.
+// feedback bits, mixed with message bits ) in
+template<const size_t bits>
+static inline void
+shift_lfsrs(uint64_t* const state, // 293 -bit state
+            const uint64_t fb      // `bits` -many feedback bits
+)
+  requires(bits <= 32)
+{
+  constexpr uint64_t mask = (1ul << bits) - 1ul;
+
+  state[6] ^= fb << 4;
+  state[0] = (state[0] >> bits) | ((state[1] & mask) << (61 - bits));
+  state[1] = (state[1] >> bits) | ((state[2] & mask) << (46 - bits));
+  state[2] = (state[2] >> bits) | ((state[3] & mask) << (47 - bits));
+  state[3] = (state[3] >> bits) | ((state[4] & mask) << (39 - bits));
+  state[4] = (state[4] >> bits) | ((state[5] & mask) << (37 - bits));
+  state[5] = (state[5] >> bits) | ((state[6] & mask) << (59 - bits));
+  state[6] = state[6] >> bits;
 }
 
-// Update state function operating on 32 -bits at a time, using algorithm
-// written in section 1.3.2 of Acorn specification
+// Update state function operating on `bits` -many positions at a time, using
+// algorithm written in section 1.3.2 of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
 //
-// Note, only use this function when `m_in` holds 32 encrypted bits & you want
-// to decrypt them back & keep in `m_out`
+// Bits of `m_in`, `ca`, `cb` are consumed starting from least significant one,
+// and bits of `m_out` follow same ordering.
 //
-// Also note, this function doesn't return 32 key stream bits ( notice above
-// overloaded variant does ) because when decrypting bits ( that's when this
-// function is supposed to be invoked ) key stream bits won't be required
-// anymore as we've already recovered plain text inside this function
+// Note, with seven u64 words representation of state, at most 32 positions can
+// be updated in one go, because tap at s_196 ( see `update_lfsrs` ) lives in
+// 37 -bit LFSR and tap at s_244 ( see `fbk128` ) is only 48 positions away from
+// s_292, where feedback bits are written to.
+//
+// Also note, in this representation updating state by `bits` -many positions
+// isn't equivalent to updating it `bits/ 8` -times, 8 positions at a time (
+// step 1 is applied on all positions, before key stream bits are generated ),
+// so a message must always be processed using same sequence of step widths.
+//
+// Direction is chosen at run-time; when `dec` is false, `m_in` holds plain text
+// bits & `m_out` receives encrypted bits, otherwise `m_in` holds encrypted bits
+// & `m_out` receives decrypted bits. Both directions share all four steps, they
+// only differ in which one of `m_in`, `m_out` ( i.e. plain text bits ) is fed
+// back into state, so a single hardware datapath serves both of them.
+template<const size_t bits>
 static inline void
-state_update_128(
-  uint64_t* const __restrict state, // 293 -bit state
-  const uint32_t m_in,              // 32 encrypted message bits
-  uint32_t* const __restrict m_out, // 32 decrypted message bits ( result ! )
-  const uint32_t ca,                // 32 control bits `a`
-  const uint32_t cb                 // 32 control bits `b`
+state_update(
+  uint64_t* const __restrict state,     // 293 -bit state
+  const uint_t<bits> m_in,              // `bits` -many input bits
+  uint_t<bits>* const __restrict m_out, // `bits` -many output bits
+  const uint_t<bits> ca,                // `bits` -many control bits `a`
+  const uint_t<bits> cb,                // `bits` -many control bits `b`
+  const bool dec                        // decrypting `m_in` ?
 )
+  requires(check_bits<bits>())
 {
-  const uint64_t w235 = state[5] >> 5;
-  const uint64_t w196 = state[4] >> 3;
-  const uint64_t w160 = state[3] >> 6;
-  const uint64_t w111 = state[2] >> 4;
-  const uint64_t w66 = state[1] >> 5;
-  const uint64_t w23 = state[0] >> 23;
-
   // step 1
-  state[6] ^= (state[5] ^ w235) & MAX_U32;
-  state[5] ^= (state[4] ^ w196) & MAX_U32;
-  state[4] ^= (state[3] ^ w160) & MAX_U32;
-  state[3] ^= (state[2] ^ w111) & MAX_U32;
-  state[2] ^= (state[1] ^ w66) & MAX_U32;
-  state[1] ^= (state[0] ^ w23) & MAX_U32;
+  update_lfsrs<bits>(state);
   // step 2
-  const uint32_t ks = ksg128(state); // 32 key stream bits
-  *m_out = m_in ^ ks;                // 32 decrypted bits
+  const uint_t<bits> ks = static_cast<uint_t<bits>>(ksg128(state));
+  const uint_t<bits> out = m_in ^ ks;
+  const uint_t<bits> txt = dec ? out : m_in;
   // step 3
-  const uint32_t fb = fbk128(state, ca, cb, ks); // 32 feedback bits
+  const uint_t<bits> fb = fbk128<bits>(state, ca, cb, ks);
   // step 4
-  state[6] ^= (static_cast<uint64_t>(fb ^ *m_out) << 4);
-  state[0] = (state[0] >> 32) | ((state[1] & MAX_U32) << 29); // 61 - 32
-  state[1] = (state[1] >> 32) | ((state[2] & MAX_U32) << 14); // 46 - 32
-  state[2] = (state[2] >> 32) | ((state[3] & MAX_U32) << 15); // 47 - 32
-  state[3] = (state[3] >> 32) | ((state[4] & MAX_U32) << 7);  // 39 - 32
-  state[4] = (state[4] >> 32) | ((state[5] & MAX_U32) << 5);  // 37 - 32
-  state[5] = (state[5] >> 32) | ((state[6] & MAX_U32) << 27); // 59 - 32
-  state[6] = state[6] >> 32;
+  shift_lfsrs<bits>(state, static_cast<uint64_t>(fb ^ txt));
+
+  *m_out = out;
 }
 
-// Update state function operating on 8 -bits at a time, using algorithm written
-// in section 1.3.2 of Acorn specification
-// https://competitions.cr.yp.to/round3/acornv3.pdf
+// Update state function operating on `bits` -many positions at a time, when
+// encrypting ( or absorbing associated data/ padding bits ), returning `bits`
+// -many key stream bits; see runtime direction variant above
 //
-// Note, if you're attempting to decrypt text back, don't use this function for
-// state updation, see below.
-static inline uint8_t
-state_update_128(uint64_t* const state, // 293 -bit state
-                 const uint8_t m,       // 8 message bits
-                 const uint8_t ca,      // 8 control bits `a`
-                 const uint8_t cb       // 8 control bits `b`
+// If you're attempting to decrypt text back, don't use this function for state
+// updation, see below.
+template<const size_t bits>
+static inline uint_t<bits>
+state_update(uint64_t* const state, // 293 -bit state
+             const uint_t<bits> m,  // `bits` -many message bits
+             const uint_t<bits> ca, // `bits` -many control bits `a`
+             const uint_t<bits> cb  // `bits` -many control bits `b`
 )
+  requires(check_bits<bits>())
 {
-  const uint64_t w235 = state[5] >> 5;
-  const uint64_t w196 = state[4] >> 3;
-  const uint64_t w160 = state[3] >> 6;
-  const uint64_t w111 = state[2] >> 4;
-  const uint64_t w66 = state[1] >> 5;
-  const uint64_t w23 = state[0] >> 23;
+  uint_t<bits> enc = 0;
+  state_update<bits>(state, m, &enc, ca, cb, false);
 
-  // step 1
-  state[6] ^= (state[5] ^ w235) & MAX_U8;
-  state[5] ^= (state[4] ^ w196) & MAX_U8;
-  state[4] ^= (state[3] ^ w160) & MAX_U8;
-  state[3] ^= (state[2] ^ w111) & MAX_U8;
-  state[2] ^= (state[1] ^ w66) & MAX_U8;
-  state[1] ^= (state[0] ^ w23) & MAX_U8;
-  // step 2
-  const uint8_t ks = static_cast<uint8_t>(ksg128(state)); // 8 key stream bits
-  // step 3
-  const uint8_t fb = fbk128(state, ca, cb, ks); // 8 feedback bits
-  // step 4
-  state[6] ^= (static_cast<uint64_t>(fb ^ m) << 4);
-  state[0] = (state[0] >> 8) | ((state[1] & MAX_U8) << 53); // 61 - 8
-  state[1] = (state[1] >> 8) | ((state[2] & MAX_U8) << 38); // 46 - 8
-  state[2] = (state[2] >> 8) | ((state[3] & MAX_U8) << 39); // 47 - 8
-  state[3] = (state[3] >> 8) | ((state[4] & MAX_U8) << 31); // 39 - 8
-  state[4] = (state[4] >> 8) | ((state[5] & MAX_U8) << 29); // 37 - 8
-  state[5] = (state[5] >> 8) | ((state[6] & MAX_U8) << 51); // 59 - 8
-  state[6] = state[6] >> 8;
-
-  return ks;
+  return static_cast<uint_t<bits>>(enc ^ m);
 }
 
-// Update state function operating on 8 -bits at a time, using algorithm written
-// in section 1.3.2 of Acorn specification
-// https://competitions.cr.yp.to/round3/acornv3.pdf
+// Update state function operating on `bits` -many positions at a time, when
+// decrypting; see runtime direction variant above
 //
-// Note, use this function for Acorn-128 state updation only when you're
-// attempting to decrypt 8 -bits. Encrypted input 8 -bits need to be present in
-// `m_in`, while decrypted output 8 -bits to live in `m_out`.
+// Note, only use this function when `m_in` holds `bits` -many encrypted bits &
+// you want to decrypt them back & keep in `m_out`
 //
-// Also note, this function doesn't need to return 8 key stream bits because
-// decrypted bits are recovered back from encrypted bits inside this function
-// body, so key steram bits are quite useless to function caller
+// Also note, this function doesn't return key stream bits ( notice above
+// overloaded variant does ) because when decrypting bits ( that's when this
+// function is supposed to be invoked ) key stream bits won't be required
+// anymore as we've already recovered plain text inside this function
+template<const size_t bits>
 static inline void
-state_update_128(uint64_t* const __restrict state, // 293 -bit state
-                 const uint8_t m_in,               // 8 encrypted message bits
-                 uint8_t* const __restrict m_out,  // 8 decrypted message bits
-                 const uint8_t ca,                 // 8 control bits `a`
-                 const uint8_t cb                  // 8 control bits `b`
+state_update(
+  uint64_t* const __restrict state,     // 293 -bit state
+  const uint_t<bits> m_in,              // `bits` -many encrypted bits
+  uint_t<bits>* const __restrict m_out, // `bits` -many decrypted bits
+  const uint_t<bits> ca,                // `bits` -many control bits `a`
+  const uint_t<bits> cb                 // `bits` -many control bits `b`
 )
+  requires(check_bits<bits>())
 {
-  const uint64_t w235 = state[5] >> 5;
-  const uint64_t w196 = state[4] >> 3;
-  const uint64_t w160 = state[3] >> 6;
-  const uint64_t w111 = state[2] >> 4;
-  const uint64_t w66 = state[1] >> 5;
-  const uint64_t w23 = state[0] >> 23;
+  state_update<bits>(state, m_in, m_out, ca, cb, true);
+}
 
+// Update state function operating on 32 positions at a time, specialized for
+// fixed phases of Acorn-128 ( i.e. initialization, padding & finalization ),
+// where control bits `ca`, `cb` are known at compile-time; see `state_update`
+//
+// Being template parameters, control bits are folded into each instantiated
+// body ( e.g. `cb & ks` disappears when cb = MIN_U32, so does `s196 & ca` when
+// ca = MIN_U32 ), even when compiler decides not to inline it, which is what
+// g++ does with generic `state_update` at -O2. So fixed phases, accounting for
+// ~97 of ~113 state updates for a 64 -bytes message, never go through generic
+// state update routine.
+template<const uint32_t ca, const uint32_t cb>
+static inline uint32_t
+state_update_fixed(uint64_t* const state, // 293 -bit state
+                   const uint32_t m       // 32 message bits
+)
+{
   // step 1
-  state[6] ^= (state[5] ^ w235) & MAX_U8;
-  state[5] ^= (state[4] ^ w196) & MAX_U8;
-  state[4] ^= (state[3] ^ w160) & MAX_U8;
-  state[3] ^= (state[2] ^ w111) & MAX_U8;
-  state[2] ^= (state[1] ^ w66) & MAX_U8;
-  state[1] ^= (state[0] ^ w23) & MAX_U8;
+  update_lfsrs<32>(state);
   // step 2
-  const uint8_t ks = static_cast<uint8_t>(ksg128(state)); // 8 key stream bits
-  *m_out = m_in ^ ks;                                     // 8 decrypted bits
+  const uint32_t ks = ksg128(state);
   // step 3
-  const uint8_t fb = fbk128(state, ca, cb, ks) ^ *m_out; // 8 feedback bits
+  const uint32_t fb = fbk128<32>(state, ca, cb, ks);
   // step 4
-  state[6] ^= (static_cast<uint64_t>(fb) << 4);
-  state[0] = (state[0] >> 8) | ((state[1] & MAX_U8) << 53); // 61 - 8
-  state[1] = (state[1] >> 8) | ((state[2] & MAX_U8) << 38); // 46 - 8
-  state[2] = (state[2] >> 8) | ((state[3] & MAX_U8) << 39); // 47 - 8
-  state[3] = (state[3] >> 8) | ((state[4] & MAX_U8) << 31); // 39 - 8
-  state[4] = (state[4] >> 8) | ((state[5] & MAX_U8) << 29); // 37 - 8
-  state[5] = (state[5] >> 8) | ((state[6] & MAX_U8) << 51); // 59 - 8
-  state[6] = state[6] >> 8;
+  shift_lfsrs<32>(state, static_cast<uint64_t>(fb ^ m));
+
+  return ks;
 }
 
 // Initialize Acorn128 state, following algorithm specified in section 1.3.3 of
@@ -328,26 +311,55 @@ initialize(
   const uint8_t* const __restrict iv   // 128 -bit initialization vector
 )
 {
+  uint32_t words[4];
+
+#if defined(__clang__)
+#pragma unroll 4
+#endif
+  for (size_t i = 0; i < 4; i++) {
+    words[i] = from_be_bytes(key + (i << 2));
+  }
+
   // --- step 2, 3, 4 ---
   for (size_t i = 0; i < 4; i++) {
-    const uint32_t word = from_be_bytes(key + (i << 2));
-    state_update_128(state, word, MAX_U32, MAX_U32);
+    state_update_fixed<MAX_U32, MAX_U32>(state, words[i]);
   }
 
   for (size_t i = 0; i < 4; i++) {
     const uint32_t word = from_be_bytes(iv + (i << 2));
-    state_update_128(state, word, MAX_U32, MAX_U32);
+    state_update_fixed<MAX_U32, MAX_U32>(state, word);
   }
 
-  state_update_128(state, from_be_bytes(key) ^ 0b1u, MAX_U32, MAX_U32);
+  state_update_fixed<MAX_U32, MAX_U32>(state, words[0] ^ 0b1u);
 
   for (size_t i = 1; i < 48; i++) {
-    const uint32_t word = from_be_bytes(key + ((i & 3) << 2));
-    state_update_128(state, word, MAX_U32, MAX_U32);
+    state_update_fixed<MAX_U32, MAX_U32>(state, words[i & 3]);
   }
   // --- step 2, 3, 4 ---
 }
 
+// Appends single `1` -bit, followed by 255 `0` -bits, after all associated
+// data bits ( when `cb` = MAX_U32 ) or plain text bits ( when `cb` = MIN_U32 )
+// are absorbed into state; see line 2, 3 of step 1 of algorithms described in
+// section 1.3.4, 1.3.5 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+template<const uint32_t cb>
+static inline void
+append_padding(uint64_t* const state) // 293 -bit state
+{
+  // append single `1` -bit
+  state_update_fixed<MAX_U32, cb>(state, 1u);
+
+  // append 255 `0` -bits
+  for (size_t i = 0; i < 4; i++) {
+    state_update_fixed<MAX_U32, cb>(state, 0u);
+  }
+
+  for (size_t i = 4; i < 8; i++) {
+    state_update_fixed<MIN_U32, cb>(state, 0u);
+  }
+}
+
 // Processing the associated data bytes, following algorithm described in
 // section 1.3.4 of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
@@ -364,115 +376,132 @@ process_associated_data(
   // line 1 of step 1; consume all associated data bits
   for (size_t i = 0; i < u32_cnt; i++) {
     const uint32_t word = from_be_bytes(data + (i << 2));
-    state_update_128(state, word, MAX_U32, MAX_U32);
+    state_update<32>(state, word, MAX_U32, MAX_U32);
   }
 
   for (size_t i = 0; i < u08_cnt; i++) {
-    state_update_128(state, data[(u32_cnt << 2) + i], MAX_U8, MAX_U8);
+    state_update<8>(state, data[(u32_cnt << 2) + i], MAX_U8, MAX_U8);
   }
 
-  // line 2 of step 1; append single `1` -bit
-  state_update_128(state, 1u, MAX_U32, MAX_U32);
-
-  // line 3 of step 1; append 255 `0` -bits
-  for (size_t i = 0; i < 4; i++) {
-    state_update_128(state, 0u, MAX_U32, MAX_U32);
-  }
-
-  for (size_t i = 4; i < 8; i++) {
-    state_update_128(state, 0u, MIN_U32, MAX_U32);
-  }
+  // line 2, 3 of step 1; append single `1` -bit, followed by 255 `0` -bits
+  append_padding<MAX_U32>(state);
 }
 
-// Encrypt plain text bytes and write ciphered bytes to allocated memory
-// location, following algorithm defined in section 1.3.5 of Acorn specification
+// Either encrypts plain text bytes ( when `dec` is false ) or decrypts ciphered
+// bytes ( when `dec` is true ), writing result to allocated memory, following
+// algorithm defined in section 1.3.5 of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// Direction is a run-time value, so that one loop body ( read one FPGA
+// pipeline ) handles messages of both directions; see `process_plain_text`/
+// `process_cipher_text` for fixed direction wrappers.
+//
+// `in` & `out` may be same buffer ( i.e. process text in-place ), because each
+// 32 -bit word/ byte is read completely before it's overwritten; they must not
+// partially overlap though.
 static inline void
-process_plain_text(uint64_t* const __restrict state,     // 293 -bit state
-                   const uint8_t* const __restrict text, // plain text bytes
-                   uint8_t* const __restrict cipher,     // ciphered data bytes
-                   const size_t ct_len                   // can be >= 0
+process_text(uint64_t* const __restrict state, // 293 -bit state
+             const uint8_t* const in,          // plain/ ciphered bytes
+             uint8_t* const out,               // ciphered/ plain bytes
+             const size_t ct_len,              // can be >= 0
+             const bool dec                    // decrypting `in` ?
 )
 {
   const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
   const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
 
-  // line 1 of step 1; compute encrypted bits
+  // line 1 of step 1; compute encrypted/ decrypted bits
   //
   // also see step 3 of algorithm defined in section 1.3.5
   for (size_t i = 0; i < u32_cnt; i++) {
-    const uint32_t dec = from_be_bytes(text + (i << 2));
-    const uint32_t ks = state_update_128(state, dec, MAX_U32, MIN_U32);
+    const uint32_t word = from_be_bytes(in + (i << 2));
+    uint32_t res = 0;
 
-    const uint32_t enc = dec ^ ks;
-    to_be_bytes(enc, cipher + (i << 2));
+    state_update<32>(state, word, &res, MAX_U32, MIN_U32, dec);
+    to_be_bytes(res, out + (i << 2));
   }
 
   for (size_t i = 0; i < u08_cnt; i++) {
-    const uint8_t dec = text[(u32_cnt << 2) + i];
-    const uint8_t ks = state_update_128(state, dec, MAX_U8, MIN_U8);
-
-    const uint8_t enc = dec ^ ks;
-    cipher[(u32_cnt << 2) + i] = enc;
+    state_update<8>(state,
+                    in[(u32_cnt << 2) + i],
+                    out + (u32_cnt << 2) + i,
+                    MAX_U8,
+                    MIN_U8,
+                    dec);
   }
 
-  // line 2 of step 1; append single `1` -bit
-  state_update_128(state, 1u, MAX_U32, MIN_U32);
-
-  // line 3 of step 1; append 255 `0` -bits
-  for (size_t i = 0; i < 4; i++) {
-    state_update_128(state, 0u, MAX_U32, MIN_U32);
-  }
+  // line 2, 3 of step 1; append single `1` -bit, followed by 255 `0` -bits
+  append_padding<MIN_U32>(state);
+}
 
-  for (size_t i = 4; i < 8; i++) {
-    state_update_128(state, 0u, MIN_U32, MIN_U32);
-  }
+// Encrypt plain text bytes and write ciphered bytes to allocated memory
+// location, following algorithm defined in section 1.3.5 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// `text` & `cipher` may be same buffer ( i.e. encrypt in-place ), see
+// `process_text`.
+static inline void
+process_plain_text(uint64_t* const __restrict state, // 293 -bit state
+                   const uint8_t* const text,        // plain text bytes
+                   uint8_t* const cipher,            // ciphered data bytes
+                   const size_t ct_len               // can be >= 0
+)
+{
+  process_text(state, text, cipher, ct_len, false);
 }
 
 // Decrypts ciphered bytes and writes them to allocated memory, following
 // algorithm defined in section 1.3.5 of Acorn specification
 // https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// `cipher` & `text` may be same buffer ( i.e. decrypt in-place ), see
+// `process_text`.
 static inline void
-process_cipher_text(
+process_cipher_text(uint64_t* const __restrict state, // 293 -bit state
+                    const uint8_t* const cipher,      // ciphered data bytes
+                    uint8_t* const text,              // plain text bytes
+                    const size_t ct_len               // can be >= 0
+)
+{
+  process_text(state, cipher, text, ct_len, true);
+}
+
+// Absorbs ciphered bytes into state, without writing decrypted bytes anywhere,
+// following algorithm defined in section 1.3.5 of Acorn specification
+// https://competitions.cr.yp.to/round3/acornv3.pdf
+//
+// Decrypted bits are still recovered ( in registers ), because they're fed
+// back into state, but they're discarded right after. Useful when only
+// authentication tag needs to be verified.
+static inline void
+absorb_cipher_text(
   uint64_t* const __restrict state,       // 293 -bit state
   const uint8_t* const __restrict cipher, // ciphered data bytes
-  uint8_t* const __restrict text,         // plain text bytes
   const size_t ct_len                     // can be >= 0
 )
 {
   const size_t u32_cnt = ct_len >> 2; // 32 -bit chunk count
   const size_t u08_cnt = ct_len % 4;  // remaining 8 -bit chunk count
 
-  // line 1 of step 1; compute decrypted bits
+  // line 1 of step 1; compute ( & discard ) decrypted bits
   //
   // also see step 3 of algorithm defined in section 1.3.5
   for (size_t i = 0; i < u32_cnt; i++) {
     const uint32_t enc = from_be_bytes(cipher + (i << 2));
     uint32_t dec = 0; // recover 32 plain text bits
 
-    state_update_128(state, enc, &dec, MAX_U32, MIN_U32);
-    to_be_bytes(dec, text + (i << 2));
+    state_update<32>(state, enc, &dec, MAX_U32, MIN_U32);
   }
 
   for (size_t i = 0; i < u08_cnt; i++) {
-    state_update_128(state,
-                     cipher[(u32_cnt << 2) + i],
-                     text + (u32_cnt << 2) + i,
-                     MAX_U8,
-                     MIN_U8);
-  }
+    const uint8_t enc = cipher[(u32_cnt << 2) + i];
+    uint8_t dec = 0; // recover 8 plain text bits
 
-  // line 2 of step 1; append single `1` -bit
-  state_update_128(state, 1u, MAX_U32, MIN_U32);
-
-  // line 3 of step 1; append 255 `0` -bits
-  for (size_t i = 0; i < 4; i++) {
-    state_update_128(state, 0u, MAX_U32, MIN_U32);
+    state_update<8>(state, enc, &dec, MAX_U8, MIN_U8);
   }
 
-  for (size_t i = 4; i < 8; i++) {
-    state_update_128(state, 0u, MIN_U32, MIN_U32);
-  }
+  // line 2, 3 of step 1; append single `1` -bit, followed by 255 `0` -bits
+  append_padding<MIN_U32>(state);
 }
 
 // Finalize Acorn-128, which generates 128 -bit authentication tag; this is
@@ -485,20 +514,13 @@ static inline void
 finalize(uint64_t* const __restrict state, uint8_t* const __restrict tag)
 {
   for (size_t i = 0; i < 20; i++) {
-    state_update_128(state, 0u, MAX_U32, MAX_U32);
+    state_update_fixed<MAX_U32, MAX_U32>(state, 0u);
   }
 
   // take last 128 keystream bits & interpret it as authentication tag
   for (size_t i = 0; i < 4; i++) {
-    const uint32_t ks = state_update_128(state, 0u, MAX_U32, MAX_U32);
-    const size_t t_off = i << 2;
-
-#if defined(__clang__)
-#pragma unroll 4
-#endif
-    for (size_t j = 0; j < 4; j++) {
-      tag[t_off + j] = static_cast<uint8_t>(ks >> ((3u - j) << 3));
-    }
+    const uint32_t ks = state_update_fixed<MAX_U32, MAX_U32>(state, 0u);
+    to_be_bytes(ks, tag + (i << 2));
   }
 }
 
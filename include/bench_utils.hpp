@@ -1,279 +1,628 @@
 #pragma once
 #include "acorn_fpga.hpp"
-#include "utils.hpp"
-
-#define GB 1073741824. // 1 << 30 bytes
-#define MB 1048576.    // 1 << 20 bytes
-#define KB 1024.       // 1 << 10 bytes
+#include "acorn_fpga_burst.hpp"
+#include "acorn_fpga_cu.hpp"
+#include "acorn_fpga_persist.hpp"
+#include "acorn_fpga_pipe.hpp"
+#include "acorn_fpga_stream.hpp"
+#include "bench_sycl_utils.hpp"
+#include <chrono>
+#include <cstring>
 
 // Benchmark Acorn-128 AEAD implementation, targeting FPGA using SYCL/ DPC++
 namespace bench_acorn_fpga {
 
-// Which one to benchmark
+// kernel flavour agnostic parts of benchmark harness ( e.g. `acorn_type`,
+// `exec_kernels`, `to_readable_bandwidth` )
+using namespace bench_acorn_sycl;
+
+// Which flavour of kernels to launch
 //
-// 0) Acorn-128 single work-item encrypt routine on FPGA
-// 1) Acorn-128 single work-item decrypt routine on FPGA
-enum acorn_type
+// 0) single work-item kernels of `acorn_fpga::` namespace
+// 1) `CU_CNT` -many replicated single work-item kernels, each owning a slice of
+// batch ( see `acorn_fpga::{encrypt,decrypt}_replicated` )
+enum kernel_type
 {
-  acorn_encrypt,
-  acorn_decrypt,
+  single_task,
+  replicated,
 };
 
-// Time execution of SYCL command, whose submission resulted into given SYCL
-// event, in nanosecond level granularity
+// Which kernel, specialized on compile-time known per message byte lengths, to
+// benchmark
 //
-// Ensure SYCL queue, onto which command was submitted, has profiling enabled !
-static inline uint64_t
-time_event(sycl::event& evt)
+// 0) single kernel, loading, encrypting & storing in same loop ( see
+// `acorn_fpga::encrypt<ct_len, d_len>` )
+// 1) reader, compute & writer kernels, connected by SYCL pipes ( see
+// `acorn_fpga::encrypt_piped<ct_len, d_len>` )
+// 2) single kernel, accessing global memory in 512 -bit lines, a group of
+// messages at a time ( see `acorn_fpga::encrypt_burst<ct_len, d_len>` )
+enum fixed_kernel_type
 {
-  // type aliasing because I wanted to keep them all single line
-  using u64 = sycl::cl_ulong;
-  using prof_t = sycl::info::event_profiling;
-
-  const prof_t BEG = prof_t::command_start;
-  const prof_t END = prof_t::command_end;
-
-  const u64 beg = evt.get_profiling_info<BEG>();
-  const u64 end = evt.get_profiling_info<END>();
+  fixed_single,
+  fixed_piped,
+  fixed_burst,
+};
 
-  return static_cast<uint64_t>(end - beg);
+// # -of compute units, instantiated when benchmarking replicated kernels
+constexpr size_t CU_CNT = 4ul;
+
+// To avoid kernel name mangling in FPGA optimization report
+class kernelRandomBytes;
+class kernelVerifyBytes;
+
+// Fills `len` -many bytes of device memory with stream `seed` of pseudo random
+// bytes ( see `bench_acorn_sycl::random_device` ), using single work-item
+// kernel
+static inline sycl::event
+random_task(sycl::queue& q,                     // SYCL job submission queue
+            uint8_t* const data,                // device memory
+            const size_t len,                   // bytes
+            const uint64_t seed,                // pseudo random stream
+            const std::vector<sycl::event> evts // SYCL runtime dependencies
+)
+{
+  const size_t word_cnt = (len + 7ul) >> 3;
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelRandomBytes>([=]() {
+      for (size_t w = 0; w < word_cnt; w++) {
+        fill_random_word(data, len, seed, w);
+      }
+    });
+  });
 }
 
-// Convert how many bytes processed in how long timespan ( given in nanosecond
-// level granularity ) to more human digestable
-// format ( i.e. GB/ s or MB/ s or KB/ s or B/ s )
-static inline const std::string
-to_readable_bandwidth(const size_t bytes, // bytes
-                      const uint64_t ts   // nanoseconds
+// Counts ( on device ) mismatching bytes & false verification flags, same as
+// `bench_acorn_sycl::verify_device` does, using single work-item kernel
+static inline sycl::event
+verify_task(sycl::queue& q,                     // SYCL job submission queue
+            const uint8_t* const data,          // device memory
+            const size_t len,                   // bytes
+            const uint64_t seed,                // pseudo random stream
+            const bool* const flags,            // device memory
+            const size_t flg_cnt,               // # -of flags
+            uint64_t* const cnt,                // device memory, mismatches
+            const std::vector<sycl::event> evts // SYCL runtime dependencies
 )
 {
-  const double bytes_ = static_cast<double>(bytes);
-  const double ts_ = static_cast<double>(ts) * 1e-9; // seconds
-  const double bps = bytes_ / ts_;                   // bytes/ sec
-
-  return bps >= GB
-           ? (std::to_string(bps / GB) + " GB/ s")
-           : bps >= MB ? (std::to_string(bps / MB) + " MB/ s")
-                       : bps >= KB ? (std::to_string(bps / KB) + " KB/ s")
-                                   : (std::to_string(bps) + " B/ s");
+  const size_t word_cnt = (len + 7ul) >> 3;
+  const size_t item_cnt = word_cnt > flg_cnt ? word_cnt : flg_cnt;
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(evts);
+    h.single_task<kernelVerifyBytes>([=]() {
+      uint64_t miss = 0ul;
+      for (size_t w = 0; w < item_cnt; w++) {
+        miss += count_mismatches(data, len, seed, flags, flg_cnt, w);
+      }
+      *cnt += miss;
+    });
+  });
 }
 
+// Single work-item Acorn-128 kernels, either one pipeline ( when `cu_cnt` = 1,
+// see `acorn_fpga::{encrypt, decrypt}` ) or `cu_cnt` -many replicated compute
+// units ( see `acorn_fpga::{encrypt, decrypt}_replicated` ), along with single
+// work-item input generation/ verification kernels; to be passed to
+// `exec_kernels`
+template<const size_t cu_cnt>
+struct single_task_kernels
+{
+  std::vector<sycl::event> encrypt(sycl::queue& q,
+                                   const buffers_t& b,
+                                   const std::vector<sycl::event> evts) const
+  {
+    if constexpr (cu_cnt == 1) {
+      return { acorn_fpga::encrypt(q,
+                                   b.keys,
+                                   b.knt_len,
+                                   b.nonces,
+                                   b.knt_len,
+                                   b.txt,
+                                   b.ct_len,
+                                   b.data,
+                                   b.dt_len,
+                                   b.enc,
+                                   b.ct_len,
+                                   b.tags,
+                                   b.knt_len,
+                                   b.invk_cnt,
+                                   evts) };
+    } else {
+      return acorn_fpga::encrypt_replicated<cu_cnt>(q,
+                                                    b.keys,
+                                                    b.knt_len,
+                                                    b.nonces,
+                                                    b.knt_len,
+                                                    b.txt,
+                                                    b.ct_len,
+                                                    b.data,
+                                                    b.dt_len,
+                                                    b.enc,
+                                                    b.ct_len,
+                                                    b.tags,
+                                                    b.knt_len,
+                                                    b.invk_cnt,
+                                                    evts);
+    }
+  }
+
+  std::vector<sycl::event> decrypt(sycl::queue& q,
+                                   const buffers_t& b,
+                                   const std::vector<sycl::event> evts) const
+  {
+    if constexpr (cu_cnt == 1) {
+      return { acorn_fpga::decrypt(q,
+                                   b.keys,
+                                   b.knt_len,
+                                   b.nonces,
+                                   b.knt_len,
+                                   b.tags,
+                                   b.knt_len,
+                                   b.enc,
+                                   b.ct_len,
+                                   b.data,
+                                   b.dt_len,
+                                   b.dec,
+                                   b.ct_len,
+                                   b.flags,
+                                   b.flg_len,
+                                   b.invk_cnt,
+                                   evts) };
+    } else {
+      return acorn_fpga::decrypt_replicated<cu_cnt>(q,
+                                                    b.keys,
+                                                    b.knt_len,
+                                                    b.nonces,
+                                                    b.knt_len,
+                                                    b.tags,
+                                                    b.knt_len,
+                                                    b.enc,
+                                                    b.ct_len,
+                                                    b.data,
+                                                    b.dt_len,
+                                                    b.dec,
+                                                    b.ct_len,
+                                                    b.flags,
+                                                    b.flg_len,
+                                                    b.invk_cnt,
+                                                    evts);
+    }
+  }
+
+  sycl::event random(sycl::queue& q,
+                     uint8_t* const data,
+                     const size_t len,
+                     const uint64_t seed) const
+  {
+    return random_task(q, data, len, seed, {});
+  }
+
+  sycl::event verify(sycl::queue& q,
+                     const uint8_t* const data,
+                     const size_t len,
+                     const uint64_t seed,
+                     const bool* const flags,
+                     const size_t flg_cnt,
+                     uint64_t* const cnt) const
+  {
+    return verify_task(q, data, len, seed, flags, flg_cnt, cnt, {});
+  }
+};
+
 // Executes accelerated Acorn-128 encrypt/ decrypt kernels ( chosen using
-// `type` parameter ) on FPGA, on `invk_cnt` -many ( read single work-item SYCL
-// FPGA kernel is iterated those many times ) independent input byte slices (
-// plain text/ cipher text/ associated data ), while returning how much time
-// spent on following
-//
-// - host -> device input tx time ( total )
-// - kernel execution time
-// - device -> host input tx time ( total )
-//
-// along with how many bytes of data were processed during aforementioned
-// activities
-//
-// - bytes of data transferred from host -> device
-// - bytes of data consumed during encryption/ decryption
-// - bytes of data transferred from device -> host
+// `type` parameter ) on FPGA, either as single work-item kernel or as `CU_CNT`
+// -many replicated compute units ( chosen using `kind` parameter ); see
+// `bench_acorn_sycl::exec_kernels` for what's measured
 static inline void
-exec_kernel(sycl::queue& q,                // SYCL job submission queue
-            const size_t per_invk_ct_len,  // bytes
-            const size_t per_invk_dt_len,  // bytes
-            const size_t invk_cnt,         // to be invoked these many times
-            acorn_type type,               // which Acorn routine to benchmark
-            uint64_t* const __restrict ts, // time spent on activities
-            size_t* const __restrict io    // processed bytes during activities
+exec_kernel(sycl::queue& q,                   // SYCL job submission queue
+            const size_t per_invk_ct_len,     // bytes
+            const size_t per_invk_dt_len,     // bytes
+            const size_t invk_cnt,            // to be invoked these many times
+            acorn_type type,                  // Acorn routine to benchmark
+            uint64_t* const __restrict ts,    // time spent on activities
+            size_t* const __restrict io,      // bytes processed in activities
+            kernel_type kind = single_task,   // which kernel flavour to launch
+            host_mem_type mem = pageable,     // where host side buffers live
+            input_src src = host_gen,         // where inputs are generated
+            acorn_usm::pool_t* pool = nullptr // device memory pool, optional
 )
 {
-  // SYCL queue must have profiling enabled !
-  assert(q.has_property<sycl::property::queue::enable_profiling>());
+  if (kind == replicated) {
+    exec_kernels(q,
+                 per_invk_ct_len,
+                 per_invk_dt_len,
+                 invk_cnt,
+                 type,
+                 ts,
+                 io,
+                 single_task_kernels<CU_CNT>{},
+                 mem,
+                 src,
+                 pool);
+  } else {
+    exec_kernels(q,
+                 per_invk_ct_len,
+                 per_invk_dt_len,
+                 invk_cnt,
+                 type,
+                 ts,
+                 io,
+                 single_task_kernels<1ul>{},
+                 mem,
+                 src,
+                 pool);
+  }
+}
 
+// Streams `invk_cnt` -many independent messages, residing in host memory,
+// through `depth` -many device buffers, in chunks of `chunk_cnt` -many messages
+// ( see `acorn_fpga::stream_{encrypt, decrypt}` ), while returning end-to-end
+// wall clock time ( in nanoseconds ) spent on whole batch, including all host
+// <-> device transfers & kernel executions, which might overlap
+//
+// Processed bytes are written to `io`, which is # -of plain/ cipher text &
+// associated data bytes consumed during encryption/ decryption
+static inline uint64_t
+exec_stream(sycl::queue& q,               // SYCL job submission queue
+            const size_t per_invk_ct_len, // bytes
+            const size_t per_invk_dt_len, // bytes
+            const size_t invk_cnt,        // # -of messages
+            const size_t chunk_cnt,       // # -of messages per chunk
+            const size_t depth,           // # -of device buffers
+            acorn_type type,              // which Acorn routine to benchmark
+            size_t* const __restrict io   // processed bytes
+)
+{
   const size_t ct_len = invk_cnt * per_invk_ct_len; // alloc memory of bytes
   const size_t dt_len = invk_cnt * per_invk_dt_len; // alloc memory of bytes
   const size_t knt_len = invk_cnt << 4;             // alloc memory of bytes
   const size_t flg_len = invk_cnt * sizeof(bool);   // alloc memory of bytes
 
-  // plain text on host
-  uint8_t* txt_h = static_cast<uint8_t*>(std::malloc(ct_len));
-  // encrypted text on host
-  uint8_t* enc_h = static_cast<uint8_t*>(std::malloc(ct_len));
-  // decrypted text on host
-  uint8_t* dec_h = static_cast<uint8_t*>(std::malloc(ct_len));
-  // associated data on host
-  uint8_t* data_h = static_cast<uint8_t*>(std::malloc(dt_len));
-  // secret keys on host
-  uint8_t* keys_h = static_cast<uint8_t*>(std::malloc(knt_len));
-  // public message nonces on host
-  uint8_t* nonces_h = static_cast<uint8_t*>(std::malloc(knt_len));
-  // authentication tags on host
-  uint8_t* tags_h = static_cast<uint8_t*>(std::malloc(knt_len));
-  // boolean verification flags on host
-  bool* flags_h = static_cast<bool*>(std::malloc(flg_len));
-
-  // plain text on accelerator
-  uint8_t* txt_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
-  // encrypted text on accelerator
-  uint8_t* enc_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
-  // decrypted text on accelerator
-  uint8_t* dec_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
-  // associated data on accelerator
-  uint8_t* data_d = static_cast<uint8_t*>(sycl::malloc_device(dt_len, q));
-  // secret keys on accelerator
-  uint8_t* keys_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
-  // public message nonces on accelerator
-  uint8_t* nonces_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
-  // authentication tags on accelerator
-  uint8_t* tags_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
-  // boolean verification flags on accelerator
-  bool* flags_d = static_cast<bool*>(sycl::malloc_device(flg_len, q));
-
-  // prepare random plain text on host
-  random_data(txt_h, ct_len);
-  // prepare random associated data on host
-  random_data(data_h, dt_len);
-  // prepare random secret keys on host
-  random_data(keys_h, knt_len);
-  // prepare random public message nonces on host
-  random_data(nonces_h, knt_len);
-
-  // zero out to-be-transferred host memory allocations
-  memset(enc_h, 0, ct_len);
-  memset(dec_h, 0, ct_len);
-  memset(tags_h, 0, knt_len);
-  memset(flags_h, 0, flg_len);
-
-  // transfer prepared ( on host ) random input bytes to accelerator
-  sycl::event evt0 = q.memcpy(txt_d, txt_h, ct_len);
-  sycl::event evt1 = q.memcpy(data_d, data_h, dt_len);
-  sycl::event evt2 = q.memcpy(keys_d, keys_h, knt_len);
-  sycl::event evt3 = q.memcpy(nonces_d, nonces_h, knt_len);
-
-  // zero out to-be-computed accelerator memory allocations
-  sycl::event evt4 = q.memset(enc_d, 0, ct_len);
-  sycl::event evt5 = q.memset(dec_d, 0, ct_len);
-  sycl::event evt6 = q.memset(tags_d, 0, knt_len);
-  sycl::event evt7 = q.memset(flags_d, 0, flg_len);
-
-  std::vector<sycl::event> evts0{ evt0, evt1, evt2, evt3, evt4, evt6 };
-
-  // Acorn-128 authenticated encryption on accelerator
-  sycl::event evt8 = acorn_fpga::encrypt(q,
-                                         keys_d,
-                                         knt_len,
-                                         nonces_d,
-                                         knt_len,
-                                         txt_d,
-                                         ct_len,
-                                         data_d,
-                                         dt_len,
-                                         enc_d,
-                                         ct_len,
-                                         tags_d,
-                                         knt_len,
-                                         invk_cnt,
-                                         evts0);
-
-  // Acorn-128 verified decryption on accelerator
-  sycl::event evt9 = acorn_fpga::decrypt(q,
-                                         keys_d,
-                                         knt_len,
-                                         nonces_d,
-                                         knt_len,
-                                         tags_d,
-                                         knt_len,
-                                         enc_d,
-                                         ct_len,
-                                         data_d,
-                                         dt_len,
-                                         dec_d,
-                                         ct_len,
-                                         flags_d,
-                                         flg_len,
-                                         invk_cnt,
-                                         { evt5, evt7, evt8 });
-
-  // transfer deciphered text back to host
-  sycl::event evt10 = q.submit([&](sycl::handler& h) {
-    h.depends_on(evt9);
-    h.memcpy(dec_h, dec_d, ct_len);
-  });
-
-  // transfer verification flags back to host
-  sycl::event evt11 = q.submit([&](sycl::handler& h) {
-    h.depends_on(evt9);
-    h.memcpy(flags_h, flags_d, flg_len);
-  });
-
-  // transfer encrypted data bytes back to host
-  sycl::event evt12 = q.submit([&](sycl::handler& h) {
-    h.depends_on(evt8);
-    h.memcpy(enc_h, enc_d, ct_len);
-  });
-
-  // transfer authentication tags back to host
-  sycl::event evt13 = q.submit([&](sycl::handler& h) {
-    h.depends_on(evt8);
-    h.memcpy(tags_h, tags_d, knt_len);
-  });
-
-  std::vector<sycl::event> evts1{ evt10, evt11, evt12, evt13 };
-  sycl::event evt14 = q.ext_oneapi_submit_barrier(evts1);
-
-  // host synchronization i.e. blocking call !
-  evt14.wait();
+  uint8_t* txt = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(std::malloc(dt_len));
+  uint8_t* keys = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* nonces = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* tags = static_cast<uint8_t*>(std::malloc(knt_len));
+  bool* flags = static_cast<bool*>(std::malloc(flg_len));
+
+  random_data(txt, ct_len);
+  random_data(data, dt_len);
+  random_data(keys, knt_len);
+  random_data(nonces, knt_len);
+
+  using namespace acorn_fpga;
+  using clk = std::chrono::high_resolution_clock;
+
+  auto t0 = clk::now();
+  stream_encrypt(q,
+                 keys,
+                 knt_len,
+                 nonces,
+                 knt_len,
+                 txt,
+                 ct_len,
+                 data,
+                 dt_len,
+                 enc,
+                 ct_len,
+                 tags,
+                 knt_len,
+                 invk_cnt,
+                 chunk_cnt,
+                 depth);
+  auto t1 = clk::now();
+  stream_decrypt(q,
+                 keys,
+                 knt_len,
+                 nonces,
+                 knt_len,
+                 tags,
+                 knt_len,
+                 enc,
+                 ct_len,
+                 data,
+                 dt_len,
+                 dec,
+                 ct_len,
+                 flags,
+                 flg_len,
+                 invk_cnt,
+                 chunk_cnt,
+                 depth);
+  auto t2 = clk::now();
 
   // test on host that everything worked as expected !
   for (size_t i = 0; i < invk_cnt; i++) {
-    assert(flags_h[i]);
+    assert(flags[i]);
 
     const size_t ct_off = i * per_invk_ct_len;
     for (size_t j = 0; j < per_invk_ct_len; j++) {
-      assert(txt_h[ct_off + j] == dec_h[ct_off + j]);
+      assert(txt[ct_off + j] == dec[ct_off + j]);
     }
   }
 
-  if (type == acorn_encrypt) {
-    const uint64_t t0 = time_event(evt0) + time_event(evt1);
-    const uint64_t t1 = time_event(evt2) + time_event(evt3);
-
-    ts[0] = t0 + t1;
-    ts[1] = time_event(evt8);
-    ts[2] = time_event(evt12) + time_event(evt13);
+  using namespace std::chrono;
+  const auto ts = type == acorn_encrypt ? duration_cast<nanoseconds>(t1 - t0)
+                                        : duration_cast<nanoseconds>(t2 - t1);
+  io[0] = ct_len + dt_len;
 
-    io[0] = ct_len + dt_len + 2 * knt_len;
-    io[1] = ct_len + dt_len;
-    io[2] = ct_len + knt_len;
-  } else if (type == acorn_decrypt) {
-    const uint64_t t0 = time_event(evt0) + time_event(evt1);
-    const uint64_t t1 = time_event(evt2) + time_event(evt3) * 2;
+  // deallocate host memory resources
+  std::free(txt);
+  std::free(enc);
+  std::free(dec);
+  std::free(data);
+  std::free(keys);
+  std::free(nonces);
+  std::free(tags);
+  std::free(flags);
+
+  return static_cast<uint64_t>(ts.count());
+}
 
-    ts[0] = t0 + t1;
-    ts[1] = time_event(evt9);
-    ts[2] = time_event(evt10) + time_event(evt11);
+// Encrypts `rounds` -many small batches of `invk_cnt` -many messages each, one
+// after another, where every batch copies its inputs to freshly obtained
+// device buffers, runs `acorn_fpga::encrypt` & copies outputs back ( see
+// `acorn_fpga::stream_encrypt`, with single chunk & single device buffer ),
+// while returning mean wall clock time ( in nanoseconds ) spent per batch
+//
+// If `pool` is given, device buffers are drawn from it, otherwise every batch
+// allocates & deallocates its own device memory.
+static inline uint64_t
+exec_small_batches(sycl::queue& q,               // SYCL job submission queue
+                   const size_t per_invk_ct_len, // bytes
+                   const size_t per_invk_dt_len, // bytes
+                   const size_t invk_cnt,        // # -of messages per batch
+                   const size_t rounds,          // # -of batches
+                   acorn_usm::pool_t* pool       // device memory pool, if any
+)
+{
+  const size_t ct_len = invk_cnt * per_invk_ct_len; // alloc memory of bytes
+  const size_t dt_len = invk_cnt * per_invk_dt_len; // alloc memory of bytes
+  const size_t knt_len = invk_cnt << 4;             // alloc memory of bytes
 
-    io[0] = ct_len + dt_len + 3 * knt_len;
-    io[1] = ct_len + dt_len;
-    io[2] = ct_len + flg_len;
+  uint8_t* txt = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(std::malloc(dt_len));
+  uint8_t* keys = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* nonces = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* tags = static_cast<uint8_t*>(std::malloc(knt_len));
+
+  random_data(txt, ct_len);
+  random_data(data, dt_len);
+  random_data(keys, knt_len);
+  random_data(nonces, knt_len);
+
+  using clk = std::chrono::high_resolution_clock;
+
+  auto t0 = clk::now();
+  for (size_t r = 0; r < rounds; r++) {
+    acorn_fpga::stream_encrypt(q,
+                               keys,
+                               knt_len,
+                               nonces,
+                               knt_len,
+                               txt,
+                               ct_len,
+                               data,
+                               dt_len,
+                               enc,
+                               ct_len,
+                               tags,
+                               knt_len,
+                               invk_cnt,
+                               invk_cnt,
+                               1,
+                               pool);
   }
+  auto t1 = clk::now();
+
+  using namespace std::chrono;
+  const auto ts = duration_cast<nanoseconds>(t1 - t0);
 
   // deallocate host memory resources
-  std::free(txt_h);
-  std::free(enc_h);
-  std::free(dec_h);
-  std::free(data_h);
-  std::free(keys_h);
-  std::free(nonces_h);
-  std::free(tags_h);
-  std::free(flags_h);
+  std::free(txt);
+  std::free(enc);
+  std::free(data);
+  std::free(keys);
+  std::free(nonces);
+  std::free(tags);
+
+  return static_cast<uint64_t>(ts.count()) / rounds;
+}
+
+// Encrypts `rounds` -many messages, one at a time, through persistent kernel (
+// see `acorn_fpga_persist::ring_t` ), where each message is pushed & its result
+// is popped before next one is pushed, while returning mean wall clock time (
+// in nanoseconds ) of a round trip; kernel launch is excluded
+static inline uint64_t
+exec_persistent(sycl::queue& q,               // SYCL job submission queue
+                const size_t per_invk_ct_len, // bytes
+                const size_t per_invk_dt_len, // bytes
+                const size_t rounds           // # -of messages
+)
+{
+  std::vector<uint8_t> txt(per_invk_ct_len);
+  std::vector<uint8_t> enc(per_invk_ct_len);
+  std::vector<uint8_t> data(per_invk_dt_len);
+  uint8_t key[16];
+  uint8_t nonce[16];
+  uint8_t tag[16];
+
+  random_data(txt.data(), per_invk_ct_len);
+  random_data(data.data(), per_invk_dt_len);
+  random_data(key, 16);
+  random_data(nonce, 16);
+
+  acorn_fpga_persist::ring_t ring{ q, 2, per_invk_ct_len, per_invk_dt_len };
+  ring.start();
+
+  using clk = std::chrono::high_resolution_clock;
+
+  auto t0 = clk::now();
+  for (size_t r = 0; r < rounds; r++) {
+    ring.push(key,
+              nonce,
+              nullptr,
+              txt.data(),
+              per_invk_ct_len,
+              data.data(),
+              per_invk_dt_len,
+              false);
+    ring.pop(enc.data(), tag);
+  }
+  auto t1 = clk::now();
+
+  ring.stop();
+
+  using namespace std::chrono;
+  const auto ts = duration_cast<nanoseconds>(t1 - t0);
+
+  return static_cast<uint64_t>(ts.count()) / rounds;
+}
+
+// Encrypts `invk_cnt` -many messages, each of `ct_len` -bytes text &
+// `d_len` -bytes associated data, generated on device ( see `random_task` ),
+// using kernel(s) specialized on those byte lengths ( chosen using `kind` ),
+// while returning kernel execution time ( in nanoseconds )
+//
+// Piped kernels run concurrently, with writer being the last one to finish, so
+// its execution time spans whole pipeline.
+//
+// Processed bytes are written to `io`, which is # -of plain text & associated
+// data bytes consumed during encryption. First & last message are checked on
+// host, against `acorn::encrypt`.
+template<const size_t ct_len, const size_t d_len>
+static inline uint64_t
+exec_fixed(sycl::queue& q,               // SYCL job submission queue
+           const size_t invk_cnt,        // # -of messages
+           const fixed_kernel_type kind, // which kernel to benchmark
+           size_t* const __restrict io   // processed bytes
+)
+{
+  // SYCL queue must have profiling enabled !
+  assert(q.has_property<sycl::property::queue::enable_profiling>());
+
+  const size_t txt_len = invk_cnt * ct_len; // alloc memory of bytes
+  const size_t dt_len = invk_cnt * d_len;   // alloc memory of bytes
+  const size_t knt_len = invk_cnt << 4;     // alloc memory of bytes
+
+  // 64 -bytes aligned, as burst kernels ask for; + 1, so that zero-length
+  // allocation is never requested
+  auto alloc = [&](const size_t len) {
+    return static_cast<uint8_t*>(sycl::aligned_alloc_device(64, len + 1, q));
+  };
+
+  uint8_t* txt_d = alloc(txt_len);
+  uint8_t* enc_d = alloc(txt_len);
+  uint8_t* data_d = alloc(dt_len);
+  uint8_t* keys_d = alloc(knt_len);
+  uint8_t* nonces_d = alloc(knt_len);
+  uint8_t* tags_d = alloc(knt_len);
+
+  std::random_device rd;
+  const uint64_t seed = (static_cast<uint64_t>(rd()) << 32) | rd();
+
+  std::vector<sycl::event> evts0{
+    random_task(q, txt_d, txt_len, seed, {}),
+    random_task(q, data_d, dt_len, seed + 1, {}),
+    random_task(q, keys_d, knt_len, seed + 2, {}),
+    random_task(q, nonces_d, knt_len, seed + 3, {}),
+  };
+
+  sycl::event evt;
+
+  if (kind == fixed_piped) {
+    evt = acorn_fpga::encrypt_piped<ct_len, d_len>(q,
+                                                    keys_d,
+                                                    knt_len,
+                                                    nonces_d,
+                                                    knt_len,
+                                                    txt_d,
+                                                    txt_len,
+                                                    data_d,
+                                                    dt_len,
+                                                    enc_d,
+                                                    txt_len,
+                                                    tags_d,
+                                                    knt_len,
+                                                    invk_cnt,
+                                                    evts0);
+  } else if (kind == fixed_burst) {
+    evt = acorn_fpga::encrypt_burst<ct_len, d_len>(q,
+                                                    keys_d,
+                                                    knt_len,
+                                                    nonces_d,
+                                                    knt_len,
+                                                    txt_d,
+                                                    txt_len,
+                                                    data_d,
+                                                    dt_len,
+                                                    enc_d,
+                                                    txt_len,
+                                                    tags_d,
+                                                    knt_len,
+                                                    invk_cnt,
+                                                    evts0);
+  } else {
+    evt = acorn_fpga::encrypt<ct_len, d_len>(q,
+                                             keys_d,
+                                             knt_len,
+                                             nonces_d,
+                                             knt_len,
+                                             txt_d,
+                                             txt_len,
+                                             data_d,
+                                             dt_len,
+                                             enc_d,
+                                             txt_len,
+                                             tags_d,
+                                             knt_len,
+                                             invk_cnt,
+                                             evts0);
+  }
+  evt.wait();
+
+  // + 1, so that zero-length array is never declared
+  uint8_t txt[ct_len + 1];
+  uint8_t enc[ct_len + 1];
+  uint8_t enc_[ct_len + 1];
+  uint8_t data[d_len + 1];
+  uint8_t key[16];
+  uint8_t nonce[16];
+  uint8_t tag[16];
+  uint8_t tag_[16];
+
+  // test on host that first & last message were encrypted as expected !
+  for (const size_t i : { size_t{ 0 }, invk_cnt - 1 }) {
+    q.memcpy(txt, txt_d + i * ct_len, ct_len);
+    q.memcpy(enc, enc_d + i * ct_len, ct_len);
+    q.memcpy(data, data_d + i * d_len, d_len);
+    q.memcpy(key, keys_d + (i << 4), 16);
+    q.memcpy(nonce, nonces_d + (i << 4), 16);
+    q.memcpy(tag, tags_d + (i << 4), 16);
+    q.wait();
+
+    acorn::encrypt(key, nonce, txt, ct_len, data, d_len, enc_, tag_);
+
+    assert(std::memcmp(enc, enc_, ct_len) == 0);
+    assert(std::memcmp(tag, tag_, 16) == 0);
+  }
+
+  io[0] = txt_len + dt_len;
 
   // deallocate SYCL runtime managed accelerator memory resources
   sycl::free(txt_d, q);
   sycl::free(enc_d, q);
-  sycl::free(dec_d, q);
   sycl::free(data_d, q);
   sycl::free(keys_d, q);
   sycl::free(nonces_d, q);
   sycl::free(tags_d, q);
-  sycl::free(flags_d, q);
+
+  return time_event(evt);
 }
 
 }
@@ -1,7 +1,13 @@
 #pragma once
 #include "acorn.hpp"
+#include "acorn_bitsliced.hpp"
+#include "acorn_iovec.hpp"
+#include "acorn_parallel.hpp"
+#include "acorn_simd.hpp"
+#include "acorn_stream.hpp"
 #include "utils.hpp"
 #include <cassert>
+#include <vector>
 #include <string.h>
 
 // Tests Acorn-128 AEAD implementation; read more about AEAD
@@ -65,12 +71,39 @@ encrypt_decrypt_success(const size_t d_len, // associated data byte-length
   // must be `true`, check to be 100% sure !
   assert(b);
 
+  // Acorn-128 tag verification, without decrypting to memory
+  const bool v = acorn::verify(key, nonce, tag, enc, ct_len, data, d_len);
+
+  // must agree with verified decryption
+  assert(v == b);
+
   // byte-by-byte compare to ensure that original plain text byte & decrypted
   // bytes match !
   for (size_t i = 0; i < ct_len; i++) {
     assert(text[i] == dec[i]);
   }
 
+  // Acorn-128 with run-time chosen direction, must agree with above, both ways
+  uint8_t* out = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t tag_[16];
+
+  const bool e =
+    acorn::crypt(key, nonce, tag_, text, ct_len, data, d_len, out, false);
+  assert(e);
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(enc[i] == out[i]);
+  }
+  for (size_t i = 0; i < 16; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  const bool d =
+    acorn::crypt(key, nonce, tag, enc, ct_len, data, d_len, out, true);
+  assert(d);
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(text[i] == out[i]);
+  }
+
   // deallocate memory resources
   free(data);
   free(text);
@@ -79,6 +112,7 @@ encrypt_decrypt_success(const size_t d_len, // associated data byte-length
   free(key);
   free(nonce);
   free(tag);
+  free(out);
 }
 
 // This test attempts to simulate that if any of associated data bytes/
@@ -162,6 +196,11 @@ encrypt_decrypt_failure(
 
   // Acorn-128 verified decryption; may fail, given that a single bit is flipped
   const bool b = acorn::decrypt(key, nonce, tag, enc, ct_len, data, d_len, dec);
+  // Acorn-128 tag verification, without decrypting to memory
+  const bool v = acorn::verify(key, nonce, tag, enc, ct_len, data, d_len);
+
+  // tag verification must always agree with verified decryption
+  assert(v == b);
 
   // if a single bit was flipped, verified decryption procedure must fail,
   // otherwise it should behave as expected !
@@ -197,4 +236,830 @@ encrypt_decrypt_failure(
   free(tag);
 }
 
+// Test that bitsliced Acorn-128 authenticated encryption/ verified decryption
+// of 64 independent messages produces same encrypted bytes, authentication
+// tags, decrypted bytes & verification flags, as `acorn::{encrypt, decrypt}`
+// produce, when invoked on each of those messages separately
+static inline void
+bitsliced_encrypt_decrypt(const size_t d_len, // associated data byte-length
+                          const size_t ct_len // plain/ cipher text byte-length
+)
+{
+  constexpr size_t lanes = acorn_bitsliced::LANE_CNT;
+
+  // how much to allocate ?
+  const size_t d_size = lanes * d_len * sizeof(uint8_t);
+  const size_t ct_size = lanes * ct_len * sizeof(uint8_t);
+  const size_t knt_size = lanes * 16 * sizeof(uint8_t); // 128 -bit each
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(lanes * sizeof(bool)));
+
+  // random associated data bytes
+  random_data(data, d_size);
+  // random plain text bytes
+  random_data(text, ct_size);
+  // random secret keys ( 128 -bit each )
+  random_data(key, knt_size);
+  // random public message nonces ( 128 -bit each )
+  random_data(nonce, knt_size);
+
+  // zero out to be filled up memory locations
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  // bitsliced Acorn-128 authenticated encryption
+  acorn_bitsliced::encrypt(key, nonce, text, ct_len, data, d_len, enc, tag);
+
+  // compare against Acorn-128 authenticated encryption, message by message
+  for (size_t i = 0; i < lanes; i++) {
+    const size_t d_off = i * d_len;
+    const size_t ct_off = i * ct_len;
+    const size_t knt_off = i << 4;
+
+    acorn::encrypt(key + knt_off,
+                   nonce + knt_off,
+                   text + ct_off,
+                   ct_len,
+                   data + d_off,
+                   d_len,
+                   enc_ + ct_off,
+                   tag_ + knt_off);
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < knt_size; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  // flip a single bit of authentication tag of last message, so that only its
+  // verification fails
+  tag[knt_size - 1] ^= static_cast<uint8_t>(0b1);
+
+  // bitsliced Acorn-128 verified decryption
+  acorn_bitsliced::decrypt(
+    key, nonce, tag, enc, ct_len, data, d_len, dec, flag);
+
+  for (size_t i = 0; i < lanes - 1; i++) {
+    assert(flag[i]);
+  }
+  assert(!flag[lanes - 1]);
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+  free(flag);
+}
+
+// Ensure that batched Acorn-128 ( see `acorn::batch_{encrypt, decrypt}` ),
+// processing `msg_cnt` independent messages, computes same encrypted bytes,
+// authentication tags, decrypted bytes & verification flags, as
+// `acorn::{encrypt, decrypt}` produce, when invoked on each of those messages
+// separately
+//
+// Choose `msg_cnt` such that it's not a multiple of `acorn_simd::LANE_CNT`, so
+// that both SIMD & leftover message processing paths are exercised.
+static inline void
+batch_encrypt_decrypt(const size_t d_len,  // associated data byte-length
+                      const size_t ct_len, // plain/ cipher text byte-length
+                      const size_t msg_cnt // # -of messages, must be > 0
+)
+{
+  assert(msg_cnt > 0);
+
+  // how much to allocate ?
+  const size_t d_size = msg_cnt * d_len * sizeof(uint8_t);
+  const size_t ct_size = msg_cnt * ct_len * sizeof(uint8_t);
+  const size_t knt_size = msg_cnt * 16 * sizeof(uint8_t); // 128 -bit each
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(msg_cnt * sizeof(bool)));
+
+  // random associated data bytes
+  random_data(data, d_size);
+  // random plain text bytes
+  random_data(text, ct_size);
+  // random secret keys ( 128 -bit each )
+  random_data(key, knt_size);
+  // random public message nonces ( 128 -bit each )
+  random_data(nonce, knt_size);
+
+  // zero out to be filled up memory locations
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  // batched Acorn-128 authenticated encryption
+  acorn::batch_encrypt(
+    key, nonce, text, ct_len, data, d_len, enc, tag, msg_cnt);
+
+  // compare against Acorn-128 authenticated encryption, message by message
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t d_off = i * d_len;
+    const size_t ct_off = i * ct_len;
+    const size_t knt_off = i << 4;
+
+    acorn::encrypt(key + knt_off,
+                   nonce + knt_off,
+                   text + ct_off,
+                   ct_len,
+                   data + d_off,
+                   d_len,
+                   enc_ + ct_off,
+                   tag_ + knt_off);
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < knt_size; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  // flip a single bit of authentication tag of first message, so that only its
+  // verification fails
+  tag[0] ^= static_cast<uint8_t>(0b1);
+
+  // batched Acorn-128 verified decryption
+  acorn::batch_decrypt(
+    key, nonce, tag, enc, ct_len, data, d_len, dec, flag, msg_cnt);
+
+  assert(!flag[0]);
+  for (size_t i = 1; i < msg_cnt; i++) {
+    assert(flag[i]);
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+  free(flag);
+}
+
+// Ensure that streaming Acorn-128 ( see `acorn::{encryptor, decryptor}` ),
+// consuming associated data & plain/ cipher text in chunks of varying length (
+// cycling through 0, 1, ..., 6 bytes ), computes same encrypted bytes,
+// authentication tag, decrypted bytes & verification flag, as
+// `acorn::{encrypt, decrypt}` do, on whole input
+static inline void
+stream_encrypt_decrypt(const size_t d_len, // associated data byte-length
+                       const size_t ct_len // plain/ cipher text byte-length
+)
+{
+  constexpr size_t max_chunk = 6ul; // chunk length cycles through [0, 6]
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_len));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len + 3));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len + 3));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(16));
+
+  random_data(data, d_len);
+  random_data(text, ct_len);
+  random_data(key, 16);
+  random_data(nonce, 16);
+
+  memset(enc, 0, ct_len + 3);
+  memset(dec, 0, ct_len + 3);
+  memset(tag, 0, 16);
+
+  acorn::encrypt(key, nonce, text, ct_len, data, d_len, enc_, tag_);
+
+  {
+    acorn::encryptor ctx{ key, nonce };
+
+    size_t chunk = 0;
+    for (size_t off = 0, itr = 0; off < d_len; itr++) {
+      chunk = std::min(itr % (max_chunk + 1), d_len - off);
+      ctx.absorb_data(data + off, chunk);
+      off += chunk;
+    }
+
+    size_t written = 0;
+    for (size_t off = 0, itr = 0; off < ct_len; itr++) {
+      chunk = std::min(itr % (max_chunk + 1), ct_len - off);
+      written += ctx.encrypt_update(text + off, chunk, enc + written);
+      off += chunk;
+    }
+
+    written += ctx.finalize(enc + written, tag);
+    assert(written == ct_len);
+  }
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < 16; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  {
+    acorn::decryptor ctx{ key, nonce };
+
+    size_t chunk = 0;
+    for (size_t off = 0, itr = 0; off < d_len; itr++) {
+      chunk = std::min(itr % (max_chunk + 1), d_len - off);
+      ctx.absorb_data(data + off, chunk);
+      off += chunk;
+    }
+
+    size_t written = 0;
+    for (size_t off = 0, itr = 0; off < ct_len; itr++) {
+      chunk = std::min(itr % (max_chunk + 1), ct_len - off);
+      written += ctx.decrypt_update(enc + off, chunk, dec + written);
+      off += chunk;
+    }
+
+    size_t tail = 0;
+    const bool flag = ctx.finalize(tag, dec + written, tail);
+    assert(flag);
+
+    written += tail;
+    assert(written == ct_len);
+  }
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+}
+
+// Ensure that in-place Acorn-128 ( see `acorn::{encrypt, decrypt}_inplace` )
+// computes same encrypted bytes, authentication tag, decrypted bytes &
+// verification flag, as out-of-place `acorn::{encrypt, decrypt}` do
+static inline void
+inplace_encrypt_decrypt(const size_t d_len, // associated data byte-length
+                        const size_t ct_len // plain/ cipher text byte-length
+)
+{
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_len));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* buf = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(16));
+
+  random_data(data, d_len);
+  random_data(text, ct_len);
+  random_data(key, 16);
+  random_data(nonce, 16);
+
+  memset(enc, 0, ct_len);
+  memset(tag, 0, 16);
+  memset(tag_, 0, 16);
+
+  acorn::encrypt(key, nonce, text, ct_len, data, d_len, enc, tag_);
+
+  // plain text -> encrypted text, in-place
+  memcpy(buf, text, ct_len);
+  acorn::encrypt_inplace(key, nonce, buf, ct_len, data, d_len, tag);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(buf[i] == enc[i]);
+  }
+
+  for (size_t i = 0; i < 16; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  // encrypted text -> decrypted text, in-place
+  using namespace acorn;
+
+  const bool b0 = decrypt_inplace(key, nonce, tag, buf, ct_len, data, d_len);
+  assert(b0);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(buf[i] == text[i]);
+  }
+
+  // flip a single bit of authentication tag, so that verification fails
+  memcpy(buf, enc, ct_len);
+  tag[0] ^= static_cast<uint8_t>(0b1);
+
+  const bool b1 = decrypt_inplace(key, nonce, tag, buf, ct_len, data, d_len);
+  assert(!b1);
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(buf);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+}
+
+// Splits `len` -bytes buffer into segments of varying length, cycling through
+// `first`, `first + 1`, ..., 6, 0, 1, ... bytes ( empty segments included )
+template<typename seg_t, typename ptr_t>
+static inline std::vector<seg_t>
+segment(ptr_t buf, const size_t len, const size_t first)
+{
+  constexpr size_t max_seg = 6ul;
+
+  std::vector<seg_t> segs;
+  for (size_t off = 0, itr = first; off < len; itr++) {
+    const size_t n = std::min(itr % (max_seg + 1), len - off);
+    segs.push_back(seg_t{ buf + off, n });
+    off += n;
+  }
+
+  return segs;
+}
+
+// Ensure that scatter/ gather Acorn-128 ( see `acorn::{encryptv, decryptv}` ),
+// consuming associated data & plain/ cipher text from differently segmented
+// lists, computes same encrypted bytes, authentication tag, decrypted bytes &
+// verification flag, as `acorn::{encrypt, decrypt}` do, on contiguous buffers
+static inline void
+iovec_encrypt_decrypt(const size_t d_len, // associated data byte-length
+                      const size_t ct_len // plain/ cipher text byte-length
+)
+{
+  using namespace acorn;
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_len));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(16));
+
+  random_data(data, d_len);
+  random_data(text, ct_len);
+  random_data(key, 16);
+  random_data(nonce, 16);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tag, 0, 16);
+
+  encrypt(key, nonce, text, ct_len, data, d_len, enc_, tag_);
+
+  const uint8_t* cdata = data;
+  const uint8_t* ctext = text;
+  const uint8_t* cenc = enc;
+
+  // input & output lists are segmented differently
+  const auto d_segs = segment<iovec_t>(cdata, d_len, 1);
+  const auto t_segs = segment<iovec_t>(ctext, ct_len, 2);
+  const auto e_segs = segment<iovec_mut_t>(enc, ct_len, 5);
+  const auto ce_segs = segment<iovec_t>(cenc, ct_len, 3);
+  const auto dc_segs = segment<iovec_mut_t>(dec, ct_len, 0);
+
+  encryptv(key,
+           nonce,
+           t_segs.data(),
+           t_segs.size(),
+           d_segs.data(),
+           d_segs.size(),
+           e_segs.data(),
+           e_segs.size(),
+           tag);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < 16; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  const bool flag = decryptv(key,
+                             nonce,
+                             tag,
+                             ce_segs.data(),
+                             ce_segs.size(),
+                             d_segs.data(),
+                             d_segs.size(),
+                             dc_segs.data(),
+                             dc_segs.size());
+  assert(flag);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+}
+
+// Ensure that Acorn-128, specialized for compile-time known byte lengths ( see
+// `acorn::{encrypt, decrypt}<ct_len, d_len>` ), computes same encrypted bytes,
+// authentication tag, decrypted bytes & verification flag, as runtime length
+// `acorn::{encrypt, decrypt}` do
+template<const size_t d_len, const size_t ct_len>
+static inline void
+static_encrypt_decrypt()
+{
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_len));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(16));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(16));
+
+  random_data(data, d_len);
+  random_data(text, ct_len);
+  random_data(key, 16);
+  random_data(nonce, 16);
+
+  memset(enc, 0, ct_len);
+  memset(enc_, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tag, 0, 16);
+  memset(tag_, 0, 16);
+
+  acorn::encrypt(key, nonce, text, ct_len, data, d_len, enc_, tag_);
+  acorn::encrypt<ct_len, d_len>(key, nonce, text, data, enc, tag);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < 16; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  using namespace acorn;
+
+  const bool b0 = decrypt<ct_len, d_len>(key, nonce, tag, enc, data, dec);
+  assert(b0);
+
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(dec[i] == text[i]);
+  }
+
+  // flip a single bit of authentication tag, so that verification fails
+  tag[0] ^= static_cast<uint8_t>(0b1);
+
+  const bool b1 = decrypt<ct_len, d_len>(key, nonce, tag, enc, data, dec);
+  assert(!b1);
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+}
+
+// Ensure that multi-threaded Acorn-128 ( see `acorn::parallel_{encrypt,
+// decrypt}` ), processing `msg_cnt` -many independent messages using given
+// thread pool, computes same encrypted bytes, authentication tags, decrypted
+// bytes & verification flags, as `acorn::{encrypt, decrypt}` produce, when
+// invoked on each of those messages separately
+static inline void
+parallel_encrypt_decrypt(
+  acorn_parallel::thread_pool_t& pool, // worker threads
+  const size_t d_len,                  // associated data byte-length
+  const size_t ct_len,                 // plain/ cipher text byte-length
+  const size_t msg_cnt                 // # -of messages, must be > 0
+)
+{
+  assert(msg_cnt > 0);
+
+  // how much to allocate ?
+  const size_t d_size = msg_cnt * d_len;
+  const size_t ct_size = msg_cnt * ct_len;
+  const size_t knt_size = msg_cnt << 4; // 128 -bit each
+  const size_t flg_size = msg_cnt * sizeof(bool);
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(flg_size));
+
+  random_data(data, d_size);
+  random_data(text, ct_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  // multi-threaded Acorn-128 authenticated encryption
+  acorn::parallel_encrypt(key,
+                          knt_size,
+                          nonce,
+                          knt_size,
+                          text,
+                          ct_size,
+                          data,
+                          d_size,
+                          enc,
+                          ct_size,
+                          tag,
+                          knt_size,
+                          msg_cnt,
+                          pool);
+
+  // compare against Acorn-128 authenticated encryption, message by message
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t d_off = i * d_len;
+    const size_t ct_off = i * ct_len;
+    const size_t knt_off = i << 4;
+
+    acorn::encrypt(key + knt_off,
+                   nonce + knt_off,
+                   text + ct_off,
+                   ct_len,
+                   data + d_off,
+                   d_len,
+                   enc_ + ct_off,
+                   tag_ + knt_off);
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < knt_size; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  // multi-threaded Acorn-128 verified decryption, all messages authentic
+  const bool b0 = acorn::parallel_decrypt(key,
+                                          knt_size,
+                                          nonce,
+                                          knt_size,
+                                          tag,
+                                          knt_size,
+                                          enc,
+                                          ct_size,
+                                          data,
+                                          d_size,
+                                          dec,
+                                          ct_size,
+                                          flag,
+                                          flg_size,
+                                          msg_cnt,
+                                          pool);
+
+  assert(b0);
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // flip a single bit of authentication tag of last message, so that only its
+  // verification fails
+  tag[knt_size - 1] ^= static_cast<uint8_t>(0b1);
+
+  const bool b1 = acorn::parallel_decrypt(key,
+                                          knt_size,
+                                          nonce,
+                                          knt_size,
+                                          tag,
+                                          knt_size,
+                                          enc,
+                                          ct_size,
+                                          data,
+                                          d_size,
+                                          dec,
+                                          ct_size,
+                                          flag,
+                                          flg_size,
+                                          msg_cnt,
+                                          pool);
+
+  assert(!b1);
+  assert(!flag[msg_cnt - 1]);
+  for (size_t i = 0; i < msg_cnt - 1; i++) {
+    assert(flag[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+  free(flag);
+}
+
+// Ensure that multi-threaded Acorn-128 on ragged batches ( see
+// `acorn::parallel_{encrypt,decrypt}_ragged` ), processing `msg_cnt` -many
+// independent messages of varying length using given thread pool & scheduling
+// policy, computes same encrypted bytes, authentication tags, decrypted bytes
+// & verification flags, as `acorn::{encrypt, decrypt}` produce, when invoked
+// on each of those messages separately
+//
+// Message lengths are skewed, so that every 16 -th message is few kilobytes
+// long, while rest are at most 100 bytes long; empty ones included.
+static inline void
+ragged_encrypt_decrypt(
+  acorn_parallel::thread_pool_t& pool,   // worker threads
+  const size_t msg_cnt,                  // # -of messages, must be > 0
+  const acorn_parallel::schedule_t sched // scheduling policy
+)
+{
+  assert(msg_cnt > 0);
+
+  std::vector<size_t> ct_off(msg_cnt + 1, 0);
+  std::vector<size_t> d_off(msg_cnt + 1, 0);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t ct_len = (i % 16 == 0) ? 4096 + i : (i * 37) % 101;
+    const size_t d_len = (i * 13) % 41;
+
+    ct_off[i + 1] = ct_off[i] + ct_len;
+    d_off[i + 1] = d_off[i] + d_len;
+  }
+
+  // how much to allocate ?
+  const size_t ct_size = ct_off[msg_cnt];
+  const size_t d_size = d_off[msg_cnt];
+  const size_t knt_size = msg_cnt << 4; // 128 -bit each
+
+  // acquire memory resources
+  uint8_t* data = static_cast<uint8_t*>(malloc(d_size));
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* enc_ = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* dec = static_cast<uint8_t*>(malloc(ct_size));
+  uint8_t* key = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(knt_size));
+  uint8_t* tag_ = static_cast<uint8_t*>(malloc(knt_size));
+  bool* flag = static_cast<bool*>(malloc(msg_cnt * sizeof(bool)));
+
+  random_data(data, d_size);
+  random_data(text, ct_size);
+  random_data(key, knt_size);
+  random_data(nonce, knt_size);
+
+  memset(enc, 0, ct_size);
+  memset(dec, 0, ct_size);
+  memset(tag, 0, knt_size);
+
+  using namespace acorn;
+
+  parallel_encrypt_ragged(key,
+                          nonce,
+                          text,
+                          ct_off.data(),
+                          data,
+                          d_off.data(),
+                          enc,
+                          tag,
+                          msg_cnt,
+                          pool,
+                          sched);
+
+  // compare against Acorn-128 authenticated encryption, message by message
+  for (size_t i = 0; i < msg_cnt; i++) {
+    encrypt(key + (i << 4),
+            nonce + (i << 4),
+            text + ct_off[i],
+            ct_off[i + 1] - ct_off[i],
+            data + d_off[i],
+            d_off[i + 1] - d_off[i],
+            enc_ + ct_off[i],
+            tag_ + (i << 4));
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(enc[i] == enc_[i]);
+  }
+
+  for (size_t i = 0; i < knt_size; i++) {
+    assert(tag[i] == tag_[i]);
+  }
+
+  // flip a single bit of authentication tag of middle message, so that only
+  // its verification fails
+  const size_t bad = msg_cnt >> 1;
+  tag[bad << 4] ^= static_cast<uint8_t>(0b1);
+
+  const bool b = parallel_decrypt_ragged(key,
+                                         nonce,
+                                         tag,
+                                         enc,
+                                         ct_off.data(),
+                                         data,
+                                         d_off.data(),
+                                         dec,
+                                         flag,
+                                         msg_cnt,
+                                         pool,
+                                         sched);
+
+  assert(!b);
+  for (size_t i = 0; i < msg_cnt; i++) {
+    assert(flag[i] == (i != bad));
+  }
+
+  for (size_t i = 0; i < ct_size; i++) {
+    assert(text[i] == dec[i]);
+  }
+
+  // deallocate memory resources
+  free(data);
+  free(text);
+  free(enc);
+  free(enc_);
+  free(dec);
+  free(key);
+  free(nonce);
+  free(tag);
+  free(tag_);
+  free(flag);
+}
+
 }
@@ -1,17 +1,28 @@
 #pragma once
 #include "acorn_fpga.hpp"
+#include "acorn_fpga_burst.hpp"
+#include "acorn_fpga_cu.hpp"
+#include "acorn_fpga_persist.hpp"
+#include "acorn_fpga_pipe.hpp"
+#include "acorn_fpga_stream.hpp"
 #include "utils.hpp"
+#include <limits>
+#include <vector>
 
 // Tests Acorn-128 AEAD implementation, targeting FPGA using SYCL/ DPC++
 namespace test_acorn_fpga {
 
 // Test (authenticated) encrypt -> (verified) decrypt flow while offloading
 // computation to ( emulated or h/w ) FPGA using SYCL/ DPC++
+//
+// Device buffers are drawn from `pool`, if one is given, so that repeated
+// calls needn't allocate device memory.
 static inline void
-encrypt_decrypt(sycl::queue& q,               // SYCL job submission queue
-                const size_t per_invk_ct_len, // bytes
-                const size_t per_invk_dt_len, // bytes
-                const size_t invk_cnt         // to be invoked these many times
+encrypt_decrypt(sycl::queue& q,                   // SYCL job submission queue
+                const size_t per_invk_ct_len,     // bytes
+                const size_t per_invk_dt_len,     // bytes
+                const size_t invk_cnt,            // # -of invocations
+                acorn_usm::pool_t* pool = nullptr // device memory pool, if any
 )
 {
   const size_t ct_len = invk_cnt * per_invk_ct_len; // alloc memory of bytes
@@ -37,21 +48,21 @@ encrypt_decrypt(sycl::queue& q,               // SYCL job submission queue
   bool* flags_h = static_cast<bool*>(std::malloc(flg_len));
 
   // plain text on accelerator
-  uint8_t* txt_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* txt_d = acorn_usm::malloc_device<uint8_t>(ct_len, q, pool);
   // encrypted text on accelerator
-  uint8_t* enc_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* enc_d = acorn_usm::malloc_device<uint8_t>(ct_len, q, pool);
   // decrypted text on accelerator
-  uint8_t* dec_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* dec_d = acorn_usm::malloc_device<uint8_t>(ct_len, q, pool);
   // associated data on accelerator
-  uint8_t* data_d = static_cast<uint8_t*>(sycl::malloc_device(dt_len, q));
+  uint8_t* data_d = acorn_usm::malloc_device<uint8_t>(dt_len, q, pool);
   // secret keys on accelerator
-  uint8_t* keys_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  uint8_t* keys_d = acorn_usm::malloc_device<uint8_t>(knt_len, q, pool);
   // public message nonces on accelerator
-  uint8_t* nonces_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  uint8_t* nonces_d = acorn_usm::malloc_device<uint8_t>(knt_len, q, pool);
   // authentication tags on accelerator
-  uint8_t* tags_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  uint8_t* tags_d = acorn_usm::malloc_device<uint8_t>(knt_len, q, pool);
   // boolean verification flags on accelerator
-  bool* flags_d = static_cast<bool*>(sycl::malloc_device(flg_len, q));
+  bool* flags_d = acorn_usm::malloc_device<bool>(invk_cnt, q, pool);
 
   // prepare random plain text on host
   random_data(txt_h, ct_len);
@@ -168,15 +179,1554 @@ encrypt_decrypt(sycl::queue& q,               // SYCL job submission queue
   std::free(tags_h);
   std::free(flags_h);
 
+  // deallocate SYCL runtime managed accelerator memory resources
+  acorn_usm::free(txt_d, q, pool);
+  acorn_usm::free(enc_d, q, pool);
+  acorn_usm::free(dec_d, q, pool);
+  acorn_usm::free(data_d, q, pool);
+  acorn_usm::free(keys_d, q, pool);
+  acorn_usm::free(nonces_d, q, pool);
+  acorn_usm::free(tags_d, q, pool);
+  acorn_usm::free(flags_d, q, pool);
+}
+
+// Shared USM buffers of a batch of `invk_cnt` -many equal length messages,
+// which both kernels & host side checks access, so that no explicit host <->
+// device data transfer is required
+struct batch_t
+{
+  size_t per_invk_ct_len; // bytes
+  size_t per_invk_dt_len; // bytes
+  size_t invk_cnt;        // # -of messages
+  size_t ct_len;          // bytes, all messages
+  size_t dt_len;          // bytes, all messages
+  size_t knt_len;         // bytes, all keys/ nonces/ tags
+  size_t flg_len;         // bytes, all verification flags
+
+  uint8_t* txt;    // plain text
+  uint8_t* enc;    // encrypted text
+  uint8_t* dec;    // decrypted text
+  uint8_t* data;   // associated data
+  uint8_t* keys;   // secret keys
+  uint8_t* nonces; // public message nonces
+  uint8_t* tags;   // authentication tags
+  bool* flags;     // verification flags
+};
+
+// Allocates shared USM buffers of a batch ( `align` -bytes aligned, if non-zero
+// ), filling inputs with random bytes & zeroing outputs
+static inline batch_t
+alloc_batch(sycl::queue& q,               // SYCL job submission queue
+            const size_t per_invk_ct_len, // bytes
+            const size_t per_invk_dt_len, // bytes
+            const size_t invk_cnt,        // # -of messages
+            const size_t align = 0ul      // alignment of buffers, in bytes
+)
+{
+  batch_t b;
+
+  b.per_invk_ct_len = per_invk_ct_len;
+  b.per_invk_dt_len = per_invk_dt_len;
+  b.invk_cnt = invk_cnt;
+  b.ct_len = invk_cnt * per_invk_ct_len;
+  b.dt_len = invk_cnt * per_invk_dt_len;
+  b.knt_len = invk_cnt << 4;
+  b.flg_len = invk_cnt * sizeof(bool);
+
+  auto alloc = [&](const size_t len) {
+    void* ptr = align > 0 ? sycl::aligned_alloc_shared(align, len, q)
+                          : sycl::malloc_shared(len, q);
+    return static_cast<uint8_t*>(ptr);
+  };
+
+  b.txt = alloc(b.ct_len);
+  b.enc = alloc(b.ct_len);
+  b.dec = alloc(b.ct_len);
+  b.data = alloc(b.dt_len);
+  b.keys = alloc(b.knt_len);
+  b.nonces = alloc(b.knt_len);
+  b.tags = alloc(b.knt_len);
+  b.flags = reinterpret_cast<bool*>(alloc(b.flg_len));
+
+  random_data(b.txt, b.ct_len);
+  random_data(b.data, b.dt_len);
+  random_data(b.keys, b.knt_len);
+  random_data(b.nonces, b.knt_len);
+
+  memset(b.enc, 0, b.ct_len);
+  memset(b.dec, 0, b.ct_len);
+  memset(b.tags, 0, b.knt_len);
+  memset(b.flags, 0, b.flg_len);
+
+  return b;
+}
+
+// Deallocates shared USM buffers of a batch
+static inline void
+free_batch(sycl::queue& q, batch_t& b)
+{
+  sycl::free(b.txt, q);
+  sycl::free(b.enc, q);
+  sycl::free(b.dec, q);
+  sycl::free(b.data, q);
+  sycl::free(b.keys, q);
+  sycl::free(b.nonces, q);
+  sycl::free(b.tags, q);
+  sycl::free(b.flags, q);
+}
+
+// Computes encrypted bytes & authentication tag of `i` -th message of batch,
+// on host, using `acorn::encrypt` with given secret key & nonce
+static inline void
+reference(const batch_t& b,
+          const size_t i,
+          const uint8_t* const __restrict key,
+          const uint8_t* const __restrict nonce,
+          uint8_t* const __restrict enc,
+          uint8_t* const __restrict tag)
+{
+  acorn::encrypt(key,
+                 nonce,
+                 b.txt + i * b.per_invk_ct_len,
+                 b.per_invk_ct_len,
+                 b.data + i * b.per_invk_dt_len,
+                 b.per_invk_dt_len,
+                 enc,
+                 tag);
+}
+
+// Ensures that every message of batch passed verification, decrypted back to
+// its plain text & that its encrypted bytes & authentication tag match those
+// computed on host, using secret key `key_of(i)` & nonce `nonce_of(i)`
+template<typename key_fn, typename nonce_fn>
+static inline void
+check_batch(const batch_t& b, key_fn key_of, nonce_fn nonce_of)
+{
+  // + 1, so that zero-length allocation is never requested
+  std::vector<uint8_t> enc_(b.per_invk_ct_len + 1);
+  uint8_t tag_[16];
+
+  for (size_t i = 0; i < b.invk_cnt; i++) {
+    assert(b.flags[i]);
+
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * b.per_invk_ct_len;
+
+    reference(b, i, key_of(i), nonce_of(i), enc_.data(), tag_);
+
+    for (size_t j = 0; j < b.per_invk_ct_len; j++) {
+      assert(b.enc[ct_off + j] == enc_[j]);
+      assert(b.txt[ct_off + j] == b.dec[ct_off + j]);
+    }
+
+    for (size_t j = 0; j < 16; j++) {
+      assert(b.tags[knt_off + j] == tag_[j]);
+    }
+  }
+}
+
+// Same as above, using per message secret keys & nonces of batch
+static inline void
+check_batch(const batch_t& b)
+{
+  check_batch(
+    b,
+    [&](const size_t i) { return b.keys + (i << 4); },
+    [&](const size_t i) { return b.nonces + (i << 4); });
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using kernels
+// specialized on compile-time known per invocation byte lengths ( see
+// `acorn_fpga::{encrypt, decrypt}<ct_len, d_len>` ), while ensuring that
+// encrypted bytes & authentication tags match those computed on host, using
+// runtime length `acorn::encrypt`
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline void
+encrypt_decrypt_fixed(sycl::queue& q,       // SYCL job submission queue
+                      const size_t invk_cnt // to be invoked these many times
+)
+{
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  // Acorn-128 authenticated encryption on accelerator
+  using namespace acorn_fpga;
+
+  sycl::event evt0 = encrypt<per_invk_ct_len, per_invk_dt_len>(q,
+                                                               b.keys,
+                                                               b.knt_len,
+                                                               b.nonces,
+                                                               b.knt_len,
+                                                               b.txt,
+                                                               b.ct_len,
+                                                               b.data,
+                                                               b.dt_len,
+                                                               b.enc,
+                                                               b.ct_len,
+                                                               b.tags,
+                                                               b.knt_len,
+                                                               invk_cnt,
+                                                               {});
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt1 = decrypt<per_invk_ct_len, per_invk_dt_len>(q,
+                                                               b.keys,
+                                                               b.knt_len,
+                                                               b.nonces,
+                                                               b.knt_len,
+                                                               b.tags,
+                                                               b.knt_len,
+                                                               b.enc,
+                                                               b.ct_len,
+                                                               b.data,
+                                                               b.dt_len,
+                                                               b.dec,
+                                                               b.ct_len,
+                                                               b.flags,
+                                                               b.flg_len,
+                                                               invk_cnt,
+                                                               { evt0 });
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  // test on host that everything worked as expected !
+  check_batch(b);
+
+  free_batch(q, b);
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using kernels
+// working on messages of varying length ( see `acorn_fpga::{encrypt,
+// decrypt}_ragged` ), while ensuring that encrypted bytes & authentication
+// tags match those computed on host, using `acorn::encrypt`
+//
+// `i` -th message carries (i * 37) % (max_ct_len + 1) -bytes plain text &
+// (i * 13) % (max_dt_len + 1) -bytes associated data, so that empty ones are
+// also covered.
+static inline void
+encrypt_decrypt_ragged(sycl::queue& q,          // SYCL job submission queue
+                       const size_t max_ct_len, // bytes
+                       const size_t max_dt_len, // bytes
+                       const size_t invk_cnt    // # -of messages
+)
+{
+  std::vector<size_t> ct_off(invk_cnt + 1, 0);
+  std::vector<size_t> dt_off(invk_cnt + 1, 0);
+
+  for (size_t i = 0; i < invk_cnt; i++) {
+    ct_off[i + 1] = ct_off[i] + (i * 37) % (max_ct_len + 1);
+    dt_off[i + 1] = dt_off[i] + (i * 13) % (max_dt_len + 1);
+  }
+
+  const size_t ct_len = ct_off[invk_cnt];                 // alloc bytes
+  const size_t dt_len = dt_off[invk_cnt];                 // alloc bytes
+  const size_t off_len = (invk_cnt + 1) * sizeof(size_t); // alloc bytes
+  const size_t knt_len = invk_cnt << 4;                   // alloc bytes
+  const size_t flg_len = invk_cnt * sizeof(bool);         // alloc bytes
+
+  // host allocations
+  uint8_t* txt_h = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* enc_h = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* dec_h = static_cast<uint8_t*>(std::malloc(ct_len));
+  uint8_t* data_h = static_cast<uint8_t*>(std::malloc(dt_len));
+  uint8_t* keys_h = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* nonces_h = static_cast<uint8_t*>(std::malloc(knt_len));
+  uint8_t* tags_h = static_cast<uint8_t*>(std::malloc(knt_len));
+  bool* flags_h = static_cast<bool*>(std::malloc(flg_len));
+
+  // accelerator allocations
+  uint8_t* txt_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* enc_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* dec_d = static_cast<uint8_t*>(sycl::malloc_device(ct_len, q));
+  uint8_t* data_d = static_cast<uint8_t*>(sycl::malloc_device(dt_len, q));
+  size_t* ct_off_d = static_cast<size_t*>(sycl::malloc_device(off_len, q));
+  size_t* dt_off_d = static_cast<size_t*>(sycl::malloc_device(off_len, q));
+  uint8_t* keys_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  uint8_t* nonces_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  uint8_t* tags_d = static_cast<uint8_t*>(sycl::malloc_device(knt_len, q));
+  bool* flags_d = static_cast<bool*>(sycl::malloc_device(flg_len, q));
+
+  random_data(txt_h, ct_len);
+  random_data(data_h, dt_len);
+  random_data(keys_h, knt_len);
+  random_data(nonces_h, knt_len);
+
+  memset(enc_h, 0, ct_len);
+  memset(dec_h, 0, ct_len);
+  memset(tags_h, 0, knt_len);
+  memset(flags_h, 0, flg_len);
+
+  // transfer prepared ( on host ) inputs & offsets to accelerator
+  sycl::event evt0 = q.memcpy(txt_d, txt_h, ct_len);
+  sycl::event evt1 = q.memcpy(data_d, data_h, dt_len);
+  sycl::event evt2 = q.memcpy(keys_d, keys_h, knt_len);
+  sycl::event evt3 = q.memcpy(nonces_d, nonces_h, knt_len);
+  sycl::event evt4 = q.memcpy(ct_off_d, ct_off.data(), off_len);
+  sycl::event evt5 = q.memcpy(dt_off_d, dt_off.data(), off_len);
+
+  std::vector<sycl::event> evts0{ evt0, evt1, evt2, evt3, evt4, evt5 };
+
+  // Acorn-128 authenticated encryption on accelerator
+  sycl::event evt6 = acorn_fpga::encrypt_ragged(q,
+                                                keys_d,
+                                                knt_len,
+                                                nonces_d,
+                                                knt_len,
+                                                txt_d,
+                                                ct_len,
+                                                ct_off_d,
+                                                data_d,
+                                                dt_len,
+                                                dt_off_d,
+                                                enc_d,
+                                                ct_len,
+                                                tags_d,
+                                                knt_len,
+                                                invk_cnt,
+                                                evts0);
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt7 = acorn_fpga::decrypt_ragged(q,
+                                                keys_d,
+                                                knt_len,
+                                                nonces_d,
+                                                knt_len,
+                                                tags_d,
+                                                knt_len,
+                                                enc_d,
+                                                ct_len,
+                                                ct_off_d,
+                                                data_d,
+                                                dt_len,
+                                                dt_off_d,
+                                                dec_d,
+                                                ct_len,
+                                                flags_d,
+                                                flg_len,
+                                                invk_cnt,
+                                                { evt6 });
+
+  // transfer outputs back to host
+  sycl::event evt8 = q.submit([&](sycl::handler& h) {
+    h.depends_on(evt6);
+    h.memcpy(enc_h, enc_d, ct_len);
+  });
+  sycl::event evt9 = q.submit([&](sycl::handler& h) {
+    h.depends_on(evt6);
+    h.memcpy(tags_h, tags_d, knt_len);
+  });
+  sycl::event evt10 = q.submit([&](sycl::handler& h) {
+    h.depends_on(evt7);
+    h.memcpy(dec_h, dec_d, ct_len);
+  });
+  sycl::event evt11 = q.submit([&](sycl::handler& h) {
+    h.depends_on(evt7);
+    h.memcpy(flags_h, flags_d, flg_len);
+  });
+
+  std::vector<sycl::event> evts1{ evt8, evt9, evt10, evt11 };
+  sycl::event evt12 = q.ext_oneapi_submit_barrier(evts1);
+
+  // host synchronization i.e. blocking call !
+  evt12.wait();
+
+  // + 1, so that zero-length allocation is never requested
+  uint8_t* enc_ = static_cast<uint8_t*>(std::malloc(max_ct_len + 1));
+  uint8_t tag_[16];
+
+  // test on host that everything worked as expected !
+  for (size_t i = 0; i < invk_cnt; i++) {
+    assert(flags_h[i]);
+
+    const size_t knt_off = i << 4;
+    const size_t ct_beg = ct_off[i];
+    const size_t ct_cnt = ct_off[i + 1] - ct_beg;
+
+    acorn::encrypt(keys_h + knt_off,
+                   nonces_h + knt_off,
+                   txt_h + ct_beg,
+                   ct_cnt,
+                   data_h + dt_off[i],
+                   dt_off[i + 1] - dt_off[i],
+                   enc_,
+                   tag_);
+
+    for (size_t j = 0; j < ct_cnt; j++) {
+      assert(enc_h[ct_beg + j] == enc_[j]);
+      assert(txt_h[ct_beg + j] == dec_h[ct_beg + j]);
+    }
+
+    for (size_t j = 0; j < 16; j++) {
+      assert(tags_h[knt_off + j] == tag_[j]);
+    }
+  }
+
+  // deallocate host memory resources
+  std::free(enc_);
+  std::free(txt_h);
+  std::free(enc_h);
+  std::free(dec_h);
+  std::free(data_h);
+  std::free(keys_h);
+  std::free(nonces_h);
+  std::free(tags_h);
+  std::free(flags_h);
+
   // deallocate SYCL runtime managed accelerator memory resources
   sycl::free(txt_d, q);
   sycl::free(enc_d, q);
   sycl::free(dec_d, q);
   sycl::free(data_d, q);
+  sycl::free(ct_off_d, q);
+  sycl::free(dt_off_d, q);
   sycl::free(keys_d, q);
   sycl::free(nonces_d, q);
   sycl::free(tags_d, q);
   sycl::free(flags_d, q);
 }
 
+// Allocates host memory of given kind i.e. USM host ( pinned )/ shared
+// allocation or pageable memory from `std::malloc`, when kind is `unknown`
+static inline void*
+alloc_host(sycl::queue& q, const size_t len, const sycl::usm::alloc kind)
+{
+  switch (kind) {
+    case sycl::usm::alloc::host:
+      return sycl::malloc_host(len, q);
+    case sycl::usm::alloc::shared:
+      return sycl::malloc_shared(len, q);
+    default:
+      return std::malloc(len);
+  }
+}
+
+// Deallocates host memory, obtained using `alloc_host`
+static inline void
+free_host(sycl::queue& q, void* ptr, const sycl::usm::alloc kind)
+{
+  if (kind == sycl::usm::alloc::host || kind == sycl::usm::alloc::shared) {
+    sycl::free(ptr, q);
+  } else {
+    std::free(ptr);
+  }
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, while streaming a
+// batch of messages, residing in host memory, through `depth` -many device
+// buffers, in chunks of `chunk_cnt` -many messages ( see `acorn_fpga::stream_
+// {encrypt, decrypt}` ), ensuring that encrypted bytes & authentication tags
+// match those computed on host, using `acorn::encrypt`
+static inline void
+stream_encrypt_decrypt(
+  sycl::queue& q,                    // SYCL job submission queue
+  const size_t per_invk_ct_len,      // bytes
+  const size_t per_invk_dt_len,      // bytes
+  const size_t invk_cnt,             // # -of messages
+  const size_t chunk_cnt,            // # -of messages per chunk
+  const size_t depth,                // # -of device buffers
+  acorn_usm::pool_t* pool = nullptr, // device memory pool, optional
+  // host memory kind; `unknown` means pageable memory from `std::malloc`
+  const sycl::usm::alloc host_kind = sycl::usm::alloc::unknown
+)
+{
+  const size_t ct_len = invk_cnt * per_invk_ct_len; // alloc memory of bytes
+  const size_t dt_len = invk_cnt * per_invk_dt_len; // alloc memory of bytes
+  const size_t knt_len = invk_cnt << 4;             // alloc memory of bytes
+  const size_t flg_len = invk_cnt * sizeof(bool);   // alloc memory of bytes
+
+  uint8_t* txt = static_cast<uint8_t*>(alloc_host(q, ct_len, host_kind));
+  uint8_t* enc = static_cast<uint8_t*>(alloc_host(q, ct_len, host_kind));
+  uint8_t* dec = static_cast<uint8_t*>(alloc_host(q, ct_len, host_kind));
+  uint8_t* data = static_cast<uint8_t*>(alloc_host(q, dt_len, host_kind));
+  uint8_t* keys = static_cast<uint8_t*>(alloc_host(q, knt_len, host_kind));
+  uint8_t* nonces = static_cast<uint8_t*>(alloc_host(q, knt_len, host_kind));
+  uint8_t* tags = static_cast<uint8_t*>(alloc_host(q, knt_len, host_kind));
+  bool* flags = static_cast<bool*>(alloc_host(q, flg_len, host_kind));
+
+  random_data(txt, ct_len);
+  random_data(data, dt_len);
+  random_data(keys, knt_len);
+  random_data(nonces, knt_len);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tags, 0, knt_len);
+  memset(flags, 0, flg_len);
+
+  using namespace acorn_fpga;
+
+  stream_encrypt(q,
+                 keys,
+                 knt_len,
+                 nonces,
+                 knt_len,
+                 txt,
+                 ct_len,
+                 data,
+                 dt_len,
+                 enc,
+                 ct_len,
+                 tags,
+                 knt_len,
+                 invk_cnt,
+                 chunk_cnt,
+                 depth,
+                 pool);
+
+  stream_decrypt(q,
+                 keys,
+                 knt_len,
+                 nonces,
+                 knt_len,
+                 tags,
+                 knt_len,
+                 enc,
+                 ct_len,
+                 data,
+                 dt_len,
+                 dec,
+                 ct_len,
+                 flags,
+                 flg_len,
+                 invk_cnt,
+                 chunk_cnt,
+                 depth,
+                 pool);
+
+  // + 1, so that zero-length allocation is never requested
+  uint8_t* enc_ = static_cast<uint8_t*>(std::malloc(per_invk_ct_len + 1));
+  uint8_t tag_[16];
+
+  // test on host that everything worked as expected !
+  for (size_t i = 0; i < invk_cnt; i++) {
+    assert(flags[i]);
+
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+    const size_t dt_off = i * per_invk_dt_len;
+
+    acorn::encrypt(keys + knt_off,
+                   nonces + knt_off,
+                   txt + ct_off,
+                   per_invk_ct_len,
+                   data + dt_off,
+                   per_invk_dt_len,
+                   enc_,
+                   tag_);
+
+    for (size_t j = 0; j < per_invk_ct_len; j++) {
+      assert(enc[ct_off + j] == enc_[j]);
+      assert(txt[ct_off + j] == dec[ct_off + j]);
+    }
+
+    for (size_t j = 0; j < 16; j++) {
+      assert(tags[knt_off + j] == tag_[j]);
+    }
+  }
+
+  // deallocate host memory resources
+  std::free(enc_);
+  free_host(q, txt, host_kind);
+  free_host(q, enc, host_kind);
+  free_host(q, dec, host_kind);
+  free_host(q, data, host_kind);
+  free_host(q, keys, host_kind);
+  free_host(q, nonces, host_kind);
+  free_host(q, tags, host_kind);
+  free_host(q, flags, host_kind);
+}
+
+// Test that repeated streamed & batch encrypt -> decrypt rounds, drawing device
+// buffers from a USM pool, produce correct results, while only first round
+// allocates device memory & every later one is served from pool
+static inline void
+pooled_encrypt_decrypt(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt,        // # -of messages
+  const size_t rounds           // # -of batches
+)
+{
+  // per batch, each of encrypt & decrypt acquires 7 device buffers
+  constexpr size_t per_round = 14ul;
+
+  assert(acorn_usm::size_class(0) == acorn_usm::MIN_CLASS);
+  assert(acorn_usm::size_class(64) == 6);
+  assert(acorn_usm::size_class(65) == 7);
+  assert(acorn_usm::size_class(4096) == 12);
+
+  acorn_usm::pool_t pool{ q, sycl::usm::alloc::device };
+
+  for (size_t r = 0; r < rounds; r++) {
+    stream_encrypt_decrypt(
+      q, per_invk_ct_len, per_invk_dt_len, invk_cnt, invk_cnt, 1, &pool);
+
+    const acorn_usm::stats_t st = pool.stats();
+
+    // encrypt & decrypt request same 7 sizes, so decrypt always hits
+    assert(st.misses == per_round >> 1);
+    assert(st.hits == per_round * (r + 1) - (per_round >> 1));
+    assert(st.in_use == 0);
+    assert(st.cached == per_round >> 1);
+  }
+
+  pool.trim();
+
+  const acorn_usm::stats_t st = pool.stats();
+  assert(st.cached == 0 && st.capacity == 0);
+
+  // batch encrypt -> decrypt acquires 8 device buffers, all held at once, so
+  // first round misses on each of them, while every later one hits
+  constexpr size_t per_batch = 8ul;
+
+  acorn_usm::pool_t pool_{ q, sycl::usm::alloc::device };
+
+  for (size_t r = 0; r < rounds; r++) {
+    encrypt_decrypt(q, per_invk_ct_len, per_invk_dt_len, invk_cnt, &pool_);
+
+    const acorn_usm::stats_t st_ = pool_.stats();
+
+    assert(st_.misses == per_batch);
+    assert(st_.hits == per_batch * r);
+    assert(st_.in_use == 0);
+    assert(st_.cached == per_batch);
+  }
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using kernels which
+// look up secret keys in a small key table, by per message key index of type
+// `idx_t` ( see `acorn_fpga::{encrypt, decrypt}_keyed` ), while ensuring that
+// encrypted bytes & authentication tags match those computed on host, using
+// `acorn::encrypt` with indexed key
+//
+// Batch is then rerun, with some key indices out of range, which must yield
+// zeroed encrypted bytes & tags, failing verification, for those messages.
+template<typename idx_t>
+static inline void
+encrypt_decrypt_keyed(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt,        // to be invoked these many times
+  const size_t key_cnt          // # -of keys in key table
+)
+{
+  const size_t key_len = key_cnt << 4;             // alloc memory of bytes
+  const size_t idx_len = invk_cnt * sizeof(idx_t); // alloc memory of bytes
+
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  // per message keys of batch are unused, instead they're looked up in table
+  uint8_t* table = static_cast<uint8_t*>(sycl::malloc_shared(key_len, q));
+  idx_t* key_idx = static_cast<idx_t*>(sycl::malloc_shared(idx_len, q));
+
+  random_data(table, key_len);
+
+  // messages are assigned keys in a scattered, repeating pattern
+  for (size_t i = 0; i < invk_cnt; i++) {
+    key_idx[i] = static_cast<idx_t>((i * 7) % key_cnt);
+  }
+
+  using namespace acorn_fpga;
+
+  // encrypts & then decrypts whole batch on accelerator, blocking
+  auto run = [&]() {
+    // Acorn-128 authenticated encryption on accelerator
+    sycl::event evt0 = encrypt_keyed<idx_t>(q,
+                                            table,
+                                            key_len,
+                                            key_idx,
+                                            idx_len,
+                                            b.nonces,
+                                            b.knt_len,
+                                            b.txt,
+                                            b.ct_len,
+                                            b.data,
+                                            b.dt_len,
+                                            b.enc,
+                                            b.ct_len,
+                                            b.tags,
+                                            b.knt_len,
+                                            invk_cnt,
+                                            {});
+
+    // Acorn-128 verified decryption on accelerator
+    sycl::event evt1 = decrypt_keyed<idx_t>(q,
+                                            table,
+                                            key_len,
+                                            key_idx,
+                                            idx_len,
+                                            b.nonces,
+                                            b.knt_len,
+                                            b.tags,
+                                            b.knt_len,
+                                            b.enc,
+                                            b.ct_len,
+                                            b.data,
+                                            b.dt_len,
+                                            b.dec,
+                                            b.ct_len,
+                                            b.flags,
+                                            b.flg_len,
+                                            invk_cnt,
+                                            { evt0 });
+
+    // host synchronization i.e. blocking call !
+    evt1.wait();
+  };
+
+  run();
+
+  // test on host that everything worked as expected !
+  check_batch(
+    b,
+    [&](const size_t i) {
+      return table + (static_cast<size_t>(key_idx[i]) << 4);
+    },
+    [&](const size_t i) { return b.nonces + (i << 4); });
+
+  // every 5th message gets an out of range key index, alternating between
+  // first invalid one & largest representable one
+  for (size_t i = 0; i < invk_cnt; i += 5) {
+    const size_t bad = (i / 5) & 1ul ? std::numeric_limits<idx_t>::max()
+                                     : key_cnt;
+    key_idx[i] = static_cast<idx_t>(bad);
+  }
+
+  run();
+
+  // + 1, so that zero-length allocation is never requested
+  std::vector<uint8_t> enc_(per_invk_ct_len + 1);
+  uint8_t tag_[16];
+
+  // messages with bad key index have zeroed result & fail verification, while
+  // rest are unaffected
+  for (size_t i = 0; i < invk_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+
+    if (i % 5 == 0) {
+      assert(!b.flags[i]);
+      for (size_t j = 0; j < per_invk_ct_len; j++) {
+        assert(b.enc[ct_off + j] == 0);
+      }
+      for (size_t j = 0; j < 16; j++) {
+        assert(b.tags[knt_off + j] == 0);
+      }
+      continue;
+    }
+
+    const uint8_t* key = table + (static_cast<size_t>(key_idx[i]) << 4);
+    reference(b, i, key, b.nonces + knt_off, enc_.data(), tag_);
+
+    assert(b.flags[i]);
+    for (size_t j = 0; j < per_invk_ct_len; j++) {
+      assert(b.enc[ct_off + j] == enc_[j]);
+      assert(b.txt[ct_off + j] == b.dec[ct_off + j]);
+    }
+    for (size_t j = 0; j < 16; j++) {
+      assert(b.tags[knt_off + j] == tag_[j]);
+    }
+  }
+
+  sycl::free(table, q);
+  sycl::free(key_idx, q);
+  free_batch(q, b);
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using kernels which
+// derive per message nonce on device, from a base nonce & either invocation
+// index or per message counter array ( see `acorn_fpga::{encrypt, decrypt}
+// _derived` ), while ensuring that encrypted bytes & authentication tags match
+// those computed on host, using `acorn::encrypt` with explicitly derived nonce
+static inline void
+encrypt_decrypt_derived(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt,        // to be invoked these many times
+  const bool use_ctr            // per message counter array or index mode
+)
+{
+  const size_t ctr_len = use_ctr ? invk_cnt << 2 : 0ul;
+
+  // per message nonces of batch are unused, instead they're derived on device
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+  uint32_t* ctr = nullptr;
+
+  // sequence number of base nonce is 2 ^ 32 - `invk_cnt`, so that index mode
+  // hands out last sequence number 0xffffffff, to last message of batch
+  const uint32_t base_seq = static_cast<uint32_t>((1ul << 32) - invk_cnt);
+
+  uint8_t base_nonce[16];
+  random_data(base_nonce, 12);
+  base_nonce[12] = static_cast<uint8_t>(base_seq >> 24);
+  base_nonce[13] = static_cast<uint8_t>(base_seq >> 16);
+  base_nonce[14] = static_cast<uint8_t>(base_seq >> 8);
+  base_nonce[15] = static_cast<uint8_t>(base_seq);
+
+  // one more message would run past 2 ^ 32 - 1 & reuse nonce of first one
+  assert(acorn_fpga::fits_sequence_space(base_nonce, invk_cnt));
+  assert(!acorn_fpga::fits_sequence_space(base_nonce, invk_cnt + 1));
+
+  if (use_ctr) {
+    ctr = static_cast<uint32_t*>(sycl::malloc_shared(ctr_len, q));
+    random_data(reinterpret_cast<uint8_t*>(ctr), ctr_len);
+  }
+
+  using namespace acorn_fpga;
+
+  // Acorn-128 authenticated encryption on accelerator
+  sycl::event evt0 = encrypt_derived(q,
+                                     b.keys,
+                                     b.knt_len,
+                                     base_nonce,
+                                     ctr,
+                                     ctr_len,
+                                     b.txt,
+                                     b.ct_len,
+                                     b.data,
+                                     b.dt_len,
+                                     b.enc,
+                                     b.ct_len,
+                                     b.tags,
+                                     b.knt_len,
+                                     invk_cnt,
+                                     {});
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt1 = decrypt_derived(q,
+                                     b.keys,
+                                     b.knt_len,
+                                     base_nonce,
+                                     ctr,
+                                     ctr_len,
+                                     b.tags,
+                                     b.knt_len,
+                                     b.enc,
+                                     b.ct_len,
+                                     b.data,
+                                     b.dt_len,
+                                     b.dec,
+                                     b.ct_len,
+                                     b.flags,
+                                     b.flg_len,
+                                     invk_cnt,
+                                     { evt0 });
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  uint8_t nonce_[16];
+
+  // test on host that everything worked as expected !
+  check_batch(
+    b,
+    [&](const size_t i) { return b.keys + (i << 4); },
+    [&](const size_t i) {
+      const uint32_t idx = static_cast<uint32_t>(i);
+      const uint32_t seq = use_ctr ? ctr[i] : base_seq + idx;
+
+      // first 96 -bits of base nonce, followed by big endian sequence number
+      std::memcpy(nonce_, base_nonce, 12);
+      nonce_[12] = static_cast<uint8_t>(seq >> 24);
+      nonce_[13] = static_cast<uint8_t>(seq >> 16);
+      nonce_[14] = static_cast<uint8_t>(seq >> 8);
+      nonce_[15] = static_cast<uint8_t>(seq);
+
+      return static_cast<const uint8_t*>(nonce_);
+    });
+
+  free_batch(q, b);
+  if (use_ctr) {
+    sycl::free(ctr, q);
+  }
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using decrypt kernel
+// emitting bit-packed verification flags, failure count & failed index list (
+// see `acorn_fpga::decrypt_packed` ), while authentication tag of every
+// `bad_every` -th message is tampered with ( 0 means none ), so that exactly
+// those messages must fail verification
+static inline void
+encrypt_decrypt_packed(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt,        // to be invoked these many times
+  const size_t bad_every,       // tamper every these many -th message
+  const size_t fail_cap         // capacity of failed index list
+)
+{
+  const size_t msk_len = ((invk_cnt + 63) >> 6) << 3; // alloc memory of bytes
+  const size_t fail_len = (fail_cap + 1) << 2;        // alloc memory of bytes
+
+  // boolean verification flags of batch are unused, instead they're bit-packed
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  uint64_t* mask = static_cast<uint64_t*>(sycl::malloc_shared(msk_len, q));
+  // last u32 holds failure count, rest is failed index list
+  uint32_t* fails = static_cast<uint32_t*>(sycl::malloc_shared(fail_len, q));
+
+  memset(mask, 0xff, msk_len);
+  memset(fails, 0xff, fail_len);
+
+  using namespace acorn_fpga;
+
+  // Acorn-128 authenticated encryption on accelerator
+  sycl::event evt0 = encrypt(q,
+                             b.keys,
+                             b.knt_len,
+                             b.nonces,
+                             b.knt_len,
+                             b.txt,
+                             b.ct_len,
+                             b.data,
+                             b.dt_len,
+                             b.enc,
+                             b.ct_len,
+                             b.tags,
+                             b.knt_len,
+                             invk_cnt,
+                             {});
+  evt0.wait();
+
+  // flip a bit in authentication tag of every `bad_every` -th message
+  size_t bad_cnt = 0;
+  for (size_t i = 0; bad_every > 0 && i < invk_cnt; i += bad_every) {
+    b.tags[(i << 4) + (i & 15)] ^= 0b1;
+    bad_cnt++;
+  }
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt1 = decrypt_packed(q,
+                                    b.keys,
+                                    b.knt_len,
+                                    b.nonces,
+                                    b.knt_len,
+                                    b.tags,
+                                    b.knt_len,
+                                    b.enc,
+                                    b.ct_len,
+                                    b.data,
+                                    b.dt_len,
+                                    b.dec,
+                                    b.ct_len,
+                                    mask,
+                                    msk_len,
+                                    fails,
+                                    fail_cap,
+                                    fails + fail_cap,
+                                    invk_cnt,
+                                    {});
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  // in all-valid case, this is all host needs to check
+  assert(fails[fail_cap] == bad_cnt);
+
+  // test on host that everything worked as expected !
+  size_t seen = 0;
+  for (size_t i = 0; i < invk_cnt; i++) {
+    const bool bad = bad_every > 0 && i % bad_every == 0;
+    const bool bit = (mask[i >> 6] >> (i & 63)) & 0b1;
+
+    assert(bit == !bad);
+
+    if (bad) {
+      if (seen < fail_cap) {
+        assert(fails[seen] == i);
+      }
+      seen++;
+      continue;
+    }
+
+    const size_t ct_off = i * per_invk_ct_len;
+    for (size_t j = 0; j < per_invk_ct_len; j++) {
+      assert(b.txt[ct_off + j] == b.dec[ct_off + j]);
+    }
+  }
+
+  // unused high bits of last mask word must be zero
+  if ((invk_cnt & 63) != 0) {
+    assert((mask[(msk_len >> 3) - 1] >> (invk_cnt & 63)) == 0);
+  }
+
+  sycl::free(mask, q);
+  sycl::free(fails, q);
+  free_batch(q, b);
+}
+
+// Test authenticated encryption, using reader, compute & writer kernels which
+// are connected by SYCL pipes ( see `acorn_fpga::encrypt_piped` ), while
+// ensuring that encrypted bytes & authentication tags match those computed on
+// host, using `acorn::encrypt`, & that they pass verified decryption, using
+// single kernel `acorn_fpga::decrypt`
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline void
+encrypt_decrypt_piped(sycl::queue& q,       // SYCL job submission queue
+                      const size_t invk_cnt // to be invoked these many times
+)
+{
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  using namespace acorn_fpga;
+
+  // Acorn-128 authenticated encryption on accelerator
+  sycl::event evt0 =
+    encrypt_piped<per_invk_ct_len, per_invk_dt_len>(q,
+                                                    b.keys,
+                                                    b.knt_len,
+                                                    b.nonces,
+                                                    b.knt_len,
+                                                    b.txt,
+                                                    b.ct_len,
+                                                    b.data,
+                                                    b.dt_len,
+                                                    b.enc,
+                                                    b.ct_len,
+                                                    b.tags,
+                                                    b.knt_len,
+                                                    invk_cnt,
+                                                    {});
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt1 = decrypt(q,
+                             b.keys,
+                             b.knt_len,
+                             b.nonces,
+                             b.knt_len,
+                             b.tags,
+                             b.knt_len,
+                             b.enc,
+                             b.ct_len,
+                             b.data,
+                             b.dt_len,
+                             b.dec,
+                             b.ct_len,
+                             b.flags,
+                             b.flg_len,
+                             invk_cnt,
+                             { evt0 });
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  // test on host that everything worked as expected !
+  check_batch(b);
+
+  free_batch(q, b);
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using `cu_cnt` -many
+// replicated compute units, each owning a slice of batch ( see `acorn_fpga::
+// {encrypt, decrypt}_replicated` ), while ensuring that encrypted bytes &
+// authentication tags match those computed on host, using `acorn::encrypt`
+template<const size_t cu_cnt>
+static inline void
+encrypt_decrypt_replicated(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt         // to be invoked these many times
+)
+{
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  using namespace acorn_fpga;
+
+  // Acorn-128 authenticated encryption on accelerator
+  std::vector<sycl::event> evts0 = encrypt_replicated<cu_cnt>(q,
+                                                              b.keys,
+                                                              b.knt_len,
+                                                              b.nonces,
+                                                              b.knt_len,
+                                                              b.txt,
+                                                              b.ct_len,
+                                                              b.data,
+                                                              b.dt_len,
+                                                              b.enc,
+                                                              b.ct_len,
+                                                              b.tags,
+                                                              b.knt_len,
+                                                              invk_cnt,
+                                                              {});
+
+  // only compute units with non-empty slice are launched
+  assert(evts0.size() == std::min(cu_cnt, invk_cnt));
+
+  // Acorn-128 verified decryption on accelerator
+  std::vector<sycl::event> evts1 = decrypt_replicated<cu_cnt>(q,
+                                                              b.keys,
+                                                              b.knt_len,
+                                                              b.nonces,
+                                                              b.knt_len,
+                                                              b.tags,
+                                                              b.knt_len,
+                                                              b.enc,
+                                                              b.ct_len,
+                                                              b.data,
+                                                              b.dt_len,
+                                                              b.dec,
+                                                              b.ct_len,
+                                                              b.flags,
+                                                              b.flg_len,
+                                                              invk_cnt,
+                                                              evts0);
+
+  // host synchronization i.e. blocking call !
+  sycl::event::wait(evts1);
+
+  // test on host that everything worked as expected !
+  check_batch(b);
+
+  free_batch(q, b);
+}
+
+// Submits unified encrypt/ decrypt kernel, on `cu_cnt` -many compute units, see
+// `acorn_fpga::crypt{,_replicated}`; when `cu_cnt` = 1, plain single kernel
+// variant is used
+template<const size_t cu_cnt>
+static inline void
+crypt(sycl::queue& q,                         // SYCL job submission queue
+      const uint8_t* const __restrict keys,   // secret keys
+      const uint8_t* const __restrict nonces, // public nonces
+      uint8_t* const __restrict tags,         // authentication tags, out/ in
+      const uint8_t* const __restrict in,     // plain/ encrypted text bytes
+      const uint8_t* const __restrict data,   // associated data
+      uint8_t* const __restrict out,          // encrypted/ decrypted text bytes
+      const bool* const __restrict dir,       // per message direction, or null
+      const bool dec,                         // batch direction
+      bool* const __restrict flags,           // verification flags
+      const size_t per_invk_ct_len,           // bytes
+      const size_t per_invk_dt_len,           // bytes
+      const size_t invk_cnt                   // to be invoked these many times
+)
+{
+  const size_t ct_len = invk_cnt * per_invk_ct_len;
+  const size_t dt_len = invk_cnt * per_invk_dt_len;
+  const size_t knt_len = invk_cnt << 4;
+  const size_t flg_len = invk_cnt * sizeof(bool);
+  const size_t dir_len = dir == nullptr ? 0 : flg_len;
+
+  if constexpr (cu_cnt == 1) {
+    sycl::event evt = acorn_fpga::crypt(q,
+                                        keys,
+                                        knt_len,
+                                        nonces,
+                                        knt_len,
+                                        tags,
+                                        knt_len,
+                                        in,
+                                        ct_len,
+                                        data,
+                                        dt_len,
+                                        out,
+                                        ct_len,
+                                        dir,
+                                        dir_len,
+                                        dec,
+                                        flags,
+                                        flg_len,
+                                        invk_cnt,
+                                        {});
+    evt.wait();
+  } else {
+    std::vector<sycl::event> evts =
+      acorn_fpga::crypt_replicated<cu_cnt>(q,
+                                           keys,
+                                           knt_len,
+                                           nonces,
+                                           knt_len,
+                                           tags,
+                                           knt_len,
+                                           in,
+                                           ct_len,
+                                           data,
+                                           dt_len,
+                                           out,
+                                           ct_len,
+                                           dir,
+                                           dir_len,
+                                           dec,
+                                           flags,
+                                           flg_len,
+                                           invk_cnt,
+                                           {});
+    sycl::event::wait(evts);
+  }
+}
+
+// Test unified encrypt/ decrypt kernel ( see `acorn_fpga::crypt` ), running on
+// `cu_cnt` -many compute units, by
+//
+// - processing a mixed-direction batch, where odd indexed messages are
+// decrypted & even indexed ones are encrypted, while tag of message 1 ( if
+// present ) is tampered with, so its verification must fail
+// - encrypting whole batch & then decrypting it back, choosing direction per
+// batch
+//
+// while ensuring that encrypted bytes & authentication tags match those
+// computed on host, using `acorn::encrypt`
+template<const size_t cu_cnt>
+static inline void
+encrypt_decrypt_unified(
+  sycl::queue& q,               // SYCL job submission queue
+  const size_t per_invk_ct_len, // bytes
+  const size_t per_invk_dt_len, // bytes
+  const size_t invk_cnt         // to be invoked these many times
+)
+{
+  // encrypted text of batch holds host computed reference, while kernel output
+  // is written to decrypted text of batch
+  batch_t b = alloc_batch(q, per_invk_ct_len, per_invk_dt_len, invk_cnt);
+
+  const size_t ct_len = b.ct_len;
+  const size_t knt_len = b.knt_len;
+  const size_t flg_len = b.flg_len;
+
+  uint8_t* in = static_cast<uint8_t*>(sycl::malloc_shared(ct_len, q));
+  uint8_t* tags_ = static_cast<uint8_t*>(sycl::malloc_shared(knt_len, q));
+  bool* dirs = static_cast<bool*>(sycl::malloc_shared(flg_len, q));
+
+  uint8_t* const txt = b.txt;
+  uint8_t* const enc = b.enc;
+  uint8_t* const out = b.dec;
+  uint8_t* const tags = b.tags;
+  bool* const flags = b.flags;
+
+  // reference encrypted bytes & authentication tags, computed on host
+  for (size_t i = 0; i < invk_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+
+    reference(b,
+              i,
+              b.keys + knt_off,
+              b.nonces + knt_off,
+              enc + ct_off,
+              tags_ + knt_off);
+  }
+
+  // mixed-direction batch; odd indexed messages are decrypted
+  for (size_t i = 0; i < invk_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+
+    dirs[i] = (i & 1ul) == 1ul;
+
+    const uint8_t* src = dirs[i] ? enc : txt;
+    memcpy(in + ct_off, src + ct_off, per_invk_ct_len);
+
+    if (dirs[i]) {
+      memcpy(tags + knt_off, tags_ + knt_off, 16);
+    } else {
+      memset(tags + knt_off, 0, 16);
+    }
+  }
+
+  if (invk_cnt > 1) {
+    tags[16] ^= 0b1u;
+  }
+
+  crypt<cu_cnt>(q,
+                b.keys,
+                b.nonces,
+                tags,
+                in,
+                b.data,
+                out,
+                dirs,
+                false,
+                flags,
+                per_invk_ct_len,
+                per_invk_dt_len,
+                invk_cnt);
+
+  for (size_t i = 0; i < invk_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+
+    // encrypted ones produce encrypted text & tag, decrypted ones plain text
+    const uint8_t* exp = dirs[i] ? txt : enc;
+
+    assert(flags[i] == (i != 1));
+    for (size_t j = 0; j < per_invk_ct_len; j++) {
+      assert(out[ct_off + j] == exp[ct_off + j]);
+    }
+
+    if (!dirs[i]) {
+      for (size_t j = 0; j < 16; j++) {
+        assert(tags[knt_off + j] == tags_[knt_off + j]);
+      }
+    }
+  }
+
+  // whole batch encrypted, direction chosen per batch
+  memset(out, 0, ct_len);
+  memset(tags, 0, knt_len);
+  memset(flags, 0, flg_len);
+
+  crypt<cu_cnt>(q,
+                b.keys,
+                b.nonces,
+                tags,
+                txt,
+                b.data,
+                out,
+                nullptr,
+                false,
+                flags,
+                per_invk_ct_len,
+                per_invk_dt_len,
+                invk_cnt);
+
+  for (size_t i = 0; i < invk_cnt; i++) {
+    assert(flags[i]);
+  }
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(out[i] == enc[i]);
+  }
+  for (size_t i = 0; i < knt_len; i++) {
+    assert(tags[i] == tags_[i]);
+  }
+
+  // whole batch decrypted back, direction chosen per batch
+  memset(in, 0, ct_len);
+  memset(flags, 0, flg_len);
+
+  crypt<cu_cnt>(q,
+                b.keys,
+                b.nonces,
+                tags,
+                out,
+                b.data,
+                in,
+                nullptr,
+                true,
+                flags,
+                per_invk_ct_len,
+                per_invk_dt_len,
+                invk_cnt);
+
+  for (size_t i = 0; i < invk_cnt; i++) {
+    assert(flags[i]);
+  }
+  for (size_t i = 0; i < ct_len; i++) {
+    assert(in[i] == txt[i]);
+  }
+
+  sycl::free(in, q);
+  sycl::free(tags_, q);
+  sycl::free(dirs, q);
+  free_batch(q, b);
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, through persistent
+// kernel, polling a ring of `slot_cnt` -many message slots ( see
+// `acorn_fpga_persist::ring_t` ), where `msg_cnt` -many messages of random
+// length ( text <= `max_ct_len`, associated data <= `max_d_len` -bytes ) are
+// pushed & popped in a sliding window, while ensuring that encrypted bytes &
+// authentication tags match those computed on host, using `acorn::encrypt`
+//
+// During decryption, tag of every 7th message is tampered with, so its
+// verification must fail. Ring is stopped & restarted in between. Finally, a
+// ring is dropped while its kernel is still running, which must stop it first.
+static inline void
+encrypt_decrypt_persistent(
+  sycl::queue& q,          // SYCL job submission queue
+  const size_t slot_cnt,   // # -of ring slots, power of 2
+  const size_t max_ct_len, // bytes
+  const size_t max_d_len,  // bytes
+  const size_t msg_cnt     // # -of messages pushed through ring
+)
+{
+  const size_t ct_len = msg_cnt * max_ct_len; // alloc memory of bytes
+  const size_t dt_len = msg_cnt * max_d_len;  // alloc memory of bytes
+  const size_t knt_len = msg_cnt << 4;        // alloc memory of bytes
+
+  std::vector<uint8_t> txt(ct_len);
+  std::vector<uint8_t> enc(ct_len);
+  std::vector<uint8_t> dec(ct_len);
+  std::vector<uint8_t> data(dt_len);
+  std::vector<uint8_t> keys(knt_len);
+  std::vector<uint8_t> nonces(knt_len);
+  std::vector<uint8_t> tags(knt_len);
+  std::vector<size_t> lens(msg_cnt << 1);
+
+  random_data(txt.data(), ct_len);
+  random_data(data.data(), dt_len);
+  random_data(keys.data(), knt_len);
+  random_data(nonces.data(), knt_len);
+  random_data(reinterpret_cast<uint8_t*>(lens.data()),
+              lens.size() * sizeof(size_t));
+
+  // i -th message lives at offset i * max_{ct,d}_len, with random length
+  for (size_t i = 0; i < msg_cnt; i++) {
+    lens[i << 1] %= max_ct_len + 1;
+    lens[(i << 1) + 1] %= max_d_len + 1;
+  }
+
+  acorn_fpga_persist::ring_t ring{ q, slot_cnt, max_ct_len, max_d_len };
+
+  for (size_t k = 0; k < 2; k++) {
+    const bool dec_ = k == 1;
+    uint8_t* out = dec_ ? dec.data() : enc.data();
+
+    ring.start();
+
+    size_t popped = 0;
+    for (size_t i = 0; i < msg_cnt; i++) {
+      const size_t knt_off = i << 4;
+      const size_t ct_off = i * max_ct_len;
+      const size_t dt_off = i * max_d_len;
+
+      const uint8_t* in = dec_ ? enc.data() : txt.data();
+
+      if (dec_ && i % 7 == 0) {
+        tags[knt_off] ^= 0b1u;
+      }
+
+      while (!ring.push(keys.data() + knt_off,
+                        nonces.data() + knt_off,
+                        tags.data() + knt_off,
+                        in + ct_off,
+                        lens[i << 1],
+                        data.data() + dt_off,
+                        lens[(i << 1) + 1],
+                        dec_)) {
+        const size_t j = popped++;
+        const bool flg = ring.pop(out + j * max_ct_len, tags.data() + (j << 4));
+        assert(flg == !(dec_ && j % 7 == 0));
+      }
+    }
+
+    ring.stop();
+
+    // results, published before stop, are still there to be collected
+    while (ring.in_flight() > 0) {
+      const size_t j = popped++;
+      const bool flg = ring.pop(out + j * max_ct_len, tags.data() + (j << 4));
+      assert(flg == !(dec_ && j % 7 == 0));
+    }
+    assert(popped == msg_cnt);
+  }
+
+  // + 1, so that zero-length allocation is never requested
+  std::vector<uint8_t> enc_(max_ct_len + 1);
+  uint8_t tag_[16];
+
+  // test on host that everything worked as expected !
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * max_ct_len;
+    const size_t dt_off = i * max_d_len;
+
+    acorn::encrypt(keys.data() + knt_off,
+                   nonces.data() + knt_off,
+                   txt.data() + ct_off,
+                   lens[i << 1],
+                   data.data() + dt_off,
+                   lens[(i << 1) + 1],
+                   enc_.data(),
+                   tag_);
+
+    for (size_t j = 0; j < lens[i << 1]; j++) {
+      assert(enc[ct_off + j] == enc_[j]);
+      assert(txt[ct_off + j] == dec[ct_off + j]);
+    }
+
+    // tampered tags have their lowest bit flipped
+    const uint8_t flip = i % 7 == 0 ? 0b1u : 0b0u;
+
+    assert(tags[knt_off] == (tag_[0] ^ flip));
+    for (size_t j = 1; j < 16; j++) {
+      assert(tags[knt_off + j] == tag_[j]);
+    }
+  }
+
+  // destructor stops running kernel, before freeing ring it's polling
+  {
+    acorn_fpga_persist::ring_t ring_{ q, slot_cnt, max_ct_len, max_d_len };
+
+    ring_.start();
+    const bool ok = ring_.push(keys.data(),
+                               nonces.data(),
+                               tags.data(),
+                               txt.data(),
+                               lens[0],
+                               data.data(),
+                               lens[1],
+                               false);
+    assert(ok);
+  }
+}
+
+// Test (authenticated) encrypt -> (verified) decrypt flow, using kernels which
+// access global memory in 512 -bit aligned lines ( see `acorn_fpga::
+// {encrypt, decrypt}_burst` ), while ensuring that encrypted bytes &
+// authentication tags match those computed on host, using `acorn::encrypt`
+//
+// Buffers of batch are 64 -bytes aligned.
+template<const size_t per_invk_ct_len, const size_t per_invk_dt_len>
+static inline void
+encrypt_decrypt_burst(sycl::queue& q,       // SYCL job submission queue
+                      const size_t invk_cnt // to be invoked these many times
+)
+{
+  constexpr size_t align = acorn_fpga_burst::LINE_LEN;
+  constexpr size_t ct = per_invk_ct_len;
+  constexpr size_t dt = per_invk_dt_len;
+
+  batch_t b = alloc_batch(q, ct, dt, invk_cnt, align);
+
+  using namespace acorn_fpga;
+
+  // Acorn-128 authenticated encryption on accelerator
+  sycl::event evt0 = encrypt_burst<ct, dt>(q,
+                                           b.keys,
+                                           b.knt_len,
+                                           b.nonces,
+                                           b.knt_len,
+                                           b.txt,
+                                           b.ct_len,
+                                           b.data,
+                                           b.dt_len,
+                                           b.enc,
+                                           b.ct_len,
+                                           b.tags,
+                                           b.knt_len,
+                                           invk_cnt,
+                                           {});
+
+  // Acorn-128 verified decryption on accelerator
+  sycl::event evt1 = decrypt_burst<ct, dt>(q,
+                                           b.keys,
+                                           b.knt_len,
+                                           b.nonces,
+                                           b.knt_len,
+                                           b.tags,
+                                           b.knt_len,
+                                           b.enc,
+                                           b.ct_len,
+                                           b.data,
+                                           b.dt_len,
+                                           b.dec,
+                                           b.ct_len,
+                                           b.flags,
+                                           b.flg_len,
+                                           invk_cnt,
+                                           { evt0 });
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  // test on host that everything worked as expected !
+  check_batch(b);
+
+  free_batch(q, b);
+}
+
 }
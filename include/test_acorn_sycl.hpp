@@ -0,0 +1,132 @@
+#pragma once
+#include "acorn_sycl.hpp"
+#include "utils.hpp"
+
+// Tests Acorn-128 AEAD implementation, targeting data-parallel SYCL devices
+namespace test_acorn_sycl {
+
+// Test (authenticated) encrypt -> (verified) decrypt flow while offloading
+// computation to data-parallel SYCL device ( say multi-core CPU ), using
+// ND-range kernels, while ensuring that encrypted bytes & authentication tags
+// match those computed on host, using `acorn::encrypt`
+//
+// Shared USM allocations are used, so that no explicit host <-> device data
+// transfer is required.
+static inline void
+encrypt_decrypt(sycl::queue& q,               // SYCL job submission queue
+                const size_t per_invk_ct_len, // bytes
+                const size_t per_invk_dt_len, // bytes
+                const size_t invk_cnt,        // # -of messages
+                const size_t wg_size          // work-group size
+)
+{
+  const size_t ct_len = invk_cnt * per_invk_ct_len; // alloc memory of bytes
+  const size_t dt_len = invk_cnt * per_invk_dt_len; // alloc memory of bytes
+  const size_t knt_len = invk_cnt << 4;             // alloc memory of bytes
+  const size_t flg_len = invk_cnt * sizeof(bool);   // alloc memory of bytes
+
+  uint8_t* txt = static_cast<uint8_t*>(sycl::malloc_shared(ct_len, q));
+  uint8_t* enc = static_cast<uint8_t*>(sycl::malloc_shared(ct_len, q));
+  uint8_t* dec = static_cast<uint8_t*>(sycl::malloc_shared(ct_len, q));
+  uint8_t* data = static_cast<uint8_t*>(sycl::malloc_shared(dt_len, q));
+  uint8_t* keys = static_cast<uint8_t*>(sycl::malloc_shared(knt_len, q));
+  uint8_t* nonces = static_cast<uint8_t*>(sycl::malloc_shared(knt_len, q));
+  uint8_t* tags = static_cast<uint8_t*>(sycl::malloc_shared(knt_len, q));
+  bool* flags = static_cast<bool*>(sycl::malloc_shared(flg_len, q));
+
+  random_data(txt, ct_len);
+  random_data(data, dt_len);
+  random_data(keys, knt_len);
+  random_data(nonces, knt_len);
+
+  memset(enc, 0, ct_len);
+  memset(dec, 0, ct_len);
+  memset(tags, 0, knt_len);
+  memset(flags, 0, flg_len);
+
+  // Acorn-128 authenticated encryption on device
+  sycl::event evt0 = acorn_sycl::encrypt(q,
+                                         keys,
+                                         knt_len,
+                                         nonces,
+                                         knt_len,
+                                         txt,
+                                         ct_len,
+                                         data,
+                                         dt_len,
+                                         enc,
+                                         ct_len,
+                                         tags,
+                                         knt_len,
+                                         invk_cnt,
+                                         wg_size,
+                                         {});
+
+  // Acorn-128 verified decryption on device
+  sycl::event evt1 = acorn_sycl::decrypt(q,
+                                         keys,
+                                         knt_len,
+                                         nonces,
+                                         knt_len,
+                                         tags,
+                                         knt_len,
+                                         enc,
+                                         ct_len,
+                                         data,
+                                         dt_len,
+                                         dec,
+                                         ct_len,
+                                         flags,
+                                         flg_len,
+                                         invk_cnt,
+                                         wg_size,
+                                         { evt0 });
+
+  // host synchronization i.e. blocking call !
+  evt1.wait();
+
+  // + 1, so that zero-length allocation is never requested
+  uint8_t* enc_ = static_cast<uint8_t*>(std::malloc(per_invk_ct_len + 1));
+  uint8_t tag_[16];
+
+  // test on host that everything worked as expected !
+  for (size_t i = 0; i < invk_cnt; i++) {
+    assert(flags[i]);
+
+    const size_t knt_off = i << 4;
+    const size_t ct_off = i * per_invk_ct_len;
+    const size_t dt_off = i * per_invk_dt_len;
+
+    acorn::encrypt(keys + knt_off,
+                   nonces + knt_off,
+                   txt + ct_off,
+                   per_invk_ct_len,
+                   data + dt_off,
+                   per_invk_dt_len,
+                   enc_,
+                   tag_);
+
+    for (size_t j = 0; j < per_invk_ct_len; j++) {
+      assert(enc[ct_off + j] == enc_[j]);
+      assert(txt[ct_off + j] == dec[ct_off + j]);
+    }
+
+    for (size_t j = 0; j < 16; j++) {
+      assert(tags[knt_off + j] == tag_[j]);
+    }
+  }
+
+  std::free(enc_);
+
+  // deallocate SYCL runtime managed shared memory resources
+  sycl::free(txt, q);
+  sycl::free(enc, q);
+  sycl::free(dec, q);
+  sycl::free(data, q);
+  sycl::free(keys, q);
+  sycl::free(nonces, q);
+  sycl::free(tags, q);
+  sycl::free(flags, q);
+}
+
+}
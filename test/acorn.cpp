@@ -7,6 +7,10 @@ main()
   constexpr size_t d_len = 64ul;  // associated data byte length
   constexpr size_t ct_len = 64ul; // plain text byte length
 
+  // few worker threads, irrespective of # -of available cores, so that
+  // multi-threaded Acorn-128 is always exercised
+  acorn_parallel::thread_pool_t pool{ 3 };
+
   // test Acorn-128 cipher suite for various combinations of associated data &
   // plain text bytes !
   for (size_t i = 0; i < d_len; i++) {
@@ -23,9 +27,42 @@ main()
       test_acorn::encrypt_decrypt_failure(i, j, test_acorn::nonce);
       // simulate failure in verified decryption by mutating secret key
       test_acorn::encrypt_decrypt_failure(i, j, test_acorn::secret_key);
+
+      // bitsliced Acorn-128 must agree with Acorn-128, on 64 messages
+      test_acorn::bitsliced_encrypt_decrypt(i, j);
+      // batched Acorn-128 must agree with Acorn-128, on few messages
+      test_acorn::batch_encrypt_decrypt(i, j, 2 * acorn_simd::LANE_CNT + 3);
+      // streaming Acorn-128 must agree with Acorn-128, on chunked input
+      test_acorn::stream_encrypt_decrypt(i, j);
+      // in-place Acorn-128 must agree with out-of-place Acorn-128
+      test_acorn::inplace_encrypt_decrypt(i, j);
+      // scatter/ gather Acorn-128 must agree with Acorn-128, on segmented input
+      test_acorn::iovec_encrypt_decrypt(i, j);
+      // multi-threaded Acorn-128 must agree with Acorn-128, on many messages
+      test_acorn::parallel_encrypt_decrypt(pool, i, j, 41);
     }
   }
 
+  // multi-threaded Acorn-128 on ragged batches must agree with Acorn-128, for
+  // both scheduling policies
+  for (size_t n = 1; n <= 97; n += 16) {
+    using namespace acorn_parallel;
+
+    test_acorn::ragged_encrypt_decrypt(pool, n, schedule_t::static_chunk);
+    test_acorn::ragged_encrypt_decrypt(pool, n, schedule_t::work_stealing);
+  }
+
+  // Acorn-128, specialized for compile-time known lengths, must agree with
+  // Acorn-128; multiples of 4 & ones with 8 -bit tail, both covered
+  test_acorn::static_encrypt_decrypt<0, 0>();
+  test_acorn::static_encrypt_decrypt<0, 1>();
+  test_acorn::static_encrypt_decrypt<3, 0>();
+  test_acorn::static_encrypt_decrypt<16, 16>();
+  test_acorn::static_encrypt_decrypt<16, 48>();
+  test_acorn::static_encrypt_decrypt<13, 61>();
+  test_acorn::static_encrypt_decrypt<32, 4096>();
+  test_acorn::static_encrypt_decrypt<31, 4095>();
+
   std::cout << "[test] passed Acorn-128 encrypt/ decrypt !" << std::endl;
 
   return EXIT_SUCCESS;
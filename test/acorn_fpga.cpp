@@ -5,6 +5,13 @@
 #define FPGA_EMU
 #endif
 
+// # -of compute units, instantiated by replicated & unified kernel tests, in
+// h/w ( i.e. `make fpga_opt_test`/ `make fpga_hw_test` ) builds; set it using
+// `-DTEST_CU_CNT=N`, when sizing compute unit count for target board
+#if !defined TEST_CU_CNT
+#define TEST_CU_CNT 2
+#endif
+
 int
 main()
 {
@@ -29,6 +36,73 @@ main()
             << std::endl;
 
   test_acorn_fpga::encrypt_decrypt(q, ct_len, dt_len, invk_cnt);
+  // kernels specialized on compile-time known byte lengths
+  test_acorn_fpga::encrypt_decrypt_fixed<ct_len - 3, dt_len - 1>(q, invk_cnt);
+  // kernels working on messages of varying length
+  test_acorn_fpga::encrypt_decrypt_ragged(q, ct_len, dt_len, invk_cnt);
+  // batch streamed through 1, 2 & 3 device buffers, in uneven chunks
+  for (size_t depth = 1; depth <= 3; depth++) {
+    test_acorn_fpga::stream_encrypt_decrypt(
+      q, ct_len, dt_len, invk_cnt, 100, depth);
+  }
+  // inputs in USM host ( pinned )/ shared memory, read by kernels directly
+  test_acorn_fpga::stream_encrypt_decrypt(
+    q, ct_len, dt_len, invk_cnt, 100, 2, nullptr, sycl::usm::alloc::host);
+  test_acorn_fpga::stream_encrypt_decrypt(
+    q, ct_len, dt_len, invk_cnt, 100, 2, nullptr, sycl::usm::alloc::shared);
+  // secret keys looked up in a key table, by u16 key index
+  test_acorn_fpga::encrypt_decrypt_keyed<uint16_t>(q, ct_len, dt_len, 1000, 5);
+  // nonces derived on device, from base nonce & index/ counter array
+  test_acorn_fpga::encrypt_decrypt_derived(q, ct_len, dt_len, invk_cnt, false);
+  test_acorn_fpga::encrypt_decrypt_derived(q, ct_len, dt_len, invk_cnt, true);
+  // bit-packed verification flags, with some tampered messages
+  test_acorn_fpga::encrypt_decrypt_packed(q, ct_len, dt_len, invk_cnt, 0, 8);
+  test_acorn_fpga::encrypt_decrypt_packed(q, ct_len, dt_len, 1000, 37, 64);
+  test_acorn_fpga::encrypt_decrypt_packed(q, ct_len, dt_len, 1000, 37, 8);
+  // reader, compute & writer kernels, connected by SYCL pipes
+  test_acorn_fpga::encrypt_decrypt_piped<ct_len - 3, dt_len - 1>(q, invk_cnt);
+  // persistent kernel, polling ring of message slots in USM host memory
+  test_acorn_fpga::encrypt_decrypt_persistent(q, 8, ct_len, dt_len, 100);
+  test_acorn_fpga::encrypt_decrypt_persistent(q, 1, ct_len - 3, dt_len, 9);
+  test_acorn_fpga::encrypt_decrypt_persistent(q, 64, ct_len, 0, 1000);
+  // 512 -bit aligned global memory accesses; groups of 64 messages, with
+  // partial last group
+  test_acorn_fpga::encrypt_decrypt_burst<61, 13>(q, 200);
+  // small batches, repeatedly drawing device buffers from USM pool
+  test_acorn_fpga::pooled_encrypt_decrypt(q, ct_len, dt_len, 16, 8);
+
+#if defined FPGA_EMU
+  // Every kernel specialization below is a distinct pipeline, so emulator runs
+  // whole matrix of configurations, while h/w image keeps one per family ( see
+  // `#else` branch ) & still fits target board.
+
+  test_acorn_fpga::encrypt_decrypt_fixed<ct_len, dt_len>(q, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_keyed<uint32_t>(
+    q, ct_len - 3, dt_len - 1, invk_cnt, acorn_fpga::MAX_KEY_CNT);
+  test_acorn_fpga::encrypt_decrypt_piped<ct_len, dt_len>(q, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_piped<0, 0>(q, 16);
+  // replicated compute units, each owning a slice of batch
+  test_acorn_fpga::encrypt_decrypt_replicated<1>(q, ct_len, dt_len, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_replicated<4>(q, ct_len, dt_len, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_replicated<3>(q, ct_len - 3, dt_len, 1000);
+  test_acorn_fpga::encrypt_decrypt_replicated<4>(q, ct_len, dt_len, 2);
+  // unified encrypt/ decrypt kernel, mixed-direction batches
+  test_acorn_fpga::encrypt_decrypt_unified<1>(q, ct_len, dt_len, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_unified<4>(q, ct_len, dt_len, invk_cnt);
+  test_acorn_fpga::encrypt_decrypt_unified<3>(q, ct_len - 3, dt_len - 1, 1000);
+  test_acorn_fpga::encrypt_decrypt_unified<2>(q, ct_len, dt_len, 1);
+  // groups of 4 messages, full & empty messages, long messages
+  test_acorn_fpga::encrypt_decrypt_burst<64, 32>(q, invk_cnt + 3);
+  test_acorn_fpga::encrypt_decrypt_burst<0, 0>(q, 7);
+  test_acorn_fpga::encrypt_decrypt_burst<4096, 16>(q, 9);
+#else
+  // replicated compute units, each owning a slice of batch; uneven split
+  test_acorn_fpga::encrypt_decrypt_replicated<TEST_CU_CNT>(
+    q, ct_len, dt_len, invk_cnt + 1);
+  // unified encrypt/ decrypt kernel, mixed-direction batches
+  test_acorn_fpga::encrypt_decrypt_unified<TEST_CU_CNT>(
+    q, ct_len, dt_len, invk_cnt);
+#endif
 
 #if defined FPGA_EMU
   std::cout << "[test] passed Acorn-128 encrypt/ decrypt on emulated FPGA !"
@@ -0,0 +1,32 @@
+#include "test_acorn_sycl.hpp"
+#include <iostream>
+
+int
+main()
+{
+  // these many independent, non-overlapping input byte sequences to be
+  // encrypted/ decrypted, deliberately not a multiple of work-group size, so
+  // that excess work-items are exercised
+  constexpr size_t invk_cnt = (1ul << 10) + 3;
+  constexpr size_t dt_len = 64ul;  // associated data byte length
+  constexpr size_t ct_len = 64ul;  // plain text byte length
+  constexpr size_t wg_size = 32ul; // work-group size
+
+  sycl::cpu_selector s{};
+
+  sycl::device d{ s };
+  sycl::context c{ d };
+  sycl::queue q{ c, d };
+
+  std::cout << "running on " << d.get_info<sycl::info::device::name>()
+            << std::endl
+            << std::endl;
+
+  test_acorn_sycl::encrypt_decrypt(q, ct_len, dt_len, invk_cnt, wg_size);
+  test_acorn_sycl::encrypt_decrypt(q, ct_len - 3, dt_len - 1, invk_cnt, 1);
+
+  std::cout << "[test] passed Acorn-128 encrypt/ decrypt on SYCL CPU device !"
+            << std::endl;
+
+  return EXIT_SUCCESS;
+}